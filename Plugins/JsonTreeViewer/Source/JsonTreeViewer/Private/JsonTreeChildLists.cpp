@@ -0,0 +1,114 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include "JsonTreeChildLists.h"
+#include "JsonTreeFilterView.h"
+
+void FJsonTreeChildLists::GetChildren(const FJsonTreeNodeStore& Store, const FJsonTreeNode& Item, FJsonTreeFilterView* Filter, int32 MaxShown, TArray<const FJsonTreeNode*>& OutChildren)
+{
+    if (const TArray<const FJsonTreeNode*>* List = Lists.Find(&Item))
+    {
+        OutChildren.Append(*List);
+        return;
+    }
+
+    TArray<const FJsonTreeNode*>& List = Lists.Add(&Item);
+    const uint32 NumShown = GetNumShown(Item, MaxShown);
+    uint32 NumChildren = Item.NumChildren;
+    if (Filter)
+    {
+        // The filter's count of an item's children takes a walk over all of them, done once per filter
+        NumChildren = Filter->GetChildren(Store, Item, List, NumShown, true);
+    }
+    else
+    {
+        Store.GetChildren(Item, List, NumShown);
+    }
+
+    // The rest of a long child list is one row until it is clicked
+    if (NumChildren > NumShown)
+    {
+        TUniquePtr<FJsonTreeNode>& More = MoreItems.FindOrAdd(&Item);
+        if (!More.IsValid())
+        {
+            More = MakeUnique<FJsonTreeNode>();
+            FMemory::Memzero(*More);
+            More->Parent = Item.Container.Self;
+            More->FirstChild = FJsonTreeNodeStore::InvalidIndex;
+            More->NextSibling = FJsonTreeNodeStore::InvalidIndex;
+            More->Type = uint8(EJson::None);
+            More->Flags = EJsonTreeNodeFlags::More;
+        }
+        More->Key = NumChildren - NumShown;
+        List.Add(More.Get());
+    }
+    OutChildren.Append(List);
+}
+
+uint32 FJsonTreeChildLists::GetNumShown(const FJsonTreeNode& Item, int32 MaxShown) const
+{
+    if (MaxShown <= 0)
+    {
+        return MAX_uint32;
+    }
+    const uint32* NumShown = NumShownByItem.Find(&Item);
+    return NumShown ? *NumShown : uint32(MaxShown);
+}
+
+const FJsonTreeNode* FJsonTreeChildLists::ShowMore(const FJsonTreeNode& Item, uint32 NumShown)
+{
+    NumShownByItem.Add(&Item, NumShown);
+    Lists.Remove(&Item);
+    const TUniquePtr<FJsonTreeNode>* More = MoreItems.Find(&Item);
+    return More ? More->Get() : nullptr;
+}
+
+void FJsonTreeChildLists::Forget(const FJsonTreeNode& Item)
+{
+    Lists.Remove(&Item);
+}
+
+void FJsonTreeChildLists::ForgetLists()
+{
+    Lists.Reset();
+}
+
+void FJsonTreeChildLists::Reset()
+{
+    Lists.Reset();
+    NumShownByItem.Reset();
+    MoreItems.Reset();
+}
+
+SIZE_T FJsonTreeChildLists::GetAllocatedSize() const
+{
+    SIZE_T Size = Lists.GetAllocatedSize() + NumShownByItem.GetAllocatedSize() + MoreItems.GetAllocatedSize() + MoreItems.Num() * sizeof(FJsonTreeNode);
+    for (const TPair<const FJsonTreeNode*, TArray<const FJsonTreeNode*>>& List : Lists)
+    {
+        Size += List.Value.GetAllocatedSize();
+    }
+    return Size;
+}
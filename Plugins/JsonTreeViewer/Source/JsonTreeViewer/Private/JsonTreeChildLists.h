@@ -0,0 +1,80 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JsonTreeNodeStore.h"
+
+class FJsonTreeFilterView;
+
+/**
+ * FJsonTreeChildLists
+ *
+ * Children a tree view lists under its expanded items: at most MaxShown of them, followed by a
+ * "... N more" row that lists the next MaxShown when clicked. The list of each expanded item is
+ * kept until it is collapsed or what it lists changes, so the refreshes of a tree view copy it
+ * instead of walking the item's child links again. MaxShown <= 0 lists every child.
+ */
+class FJsonTreeChildLists
+{
+public:
+    // Children of an expanded item, listed through Filter if it is set. The first call for an item
+    // builds its list; later ones copy it.
+    void GetChildren(const FJsonTreeNodeStore& Store, const FJsonTreeNode& Item, FJsonTreeFilterView* Filter, int32 MaxShown, TArray<const FJsonTreeNode*>& OutChildren);
+
+    // Number of children listed under an item, MAX_uint32 for all of them
+    uint32 GetNumShown(const FJsonTreeNode& Item, int32 MaxShown) const;
+
+    // List the first NumShown children of an item from now on. Returns its "... N more" row, whose
+    // count is about to change, or null if it has none yet.
+    const FJsonTreeNode* ShowMore(const FJsonTreeNode& Item, uint32 NumShown);
+
+    // Drop the kept list of one item, e.g. once it is collapsed
+    void Forget(const FJsonTreeNode& Item);
+
+    // Drop every kept list, e.g. when a filter or a patch changes what items list; how many children
+    // each item shows stays
+    void ForgetLists();
+
+    // Drop everything, once node pointers change
+    void Reset();
+
+    // "... N more" rows by the item they belong to
+    const TMap<const FJsonTreeNode*, TUniquePtr<FJsonTreeNode>>& GetMoreItems() const { return MoreItems; }
+
+    // Bytes held by the lists and the "... N more" rows
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    // Listed children of expanded items, ending in the "... N more" row where there is one
+    TMap<const FJsonTreeNode*, TArray<const FJsonTreeNode*>> Lists;
+
+    // Children shown by items whose "... N more" row was clicked
+    TMap<const FJsonTreeNode*, uint32> NumShownByItem;
+
+    TMap<const FJsonTreeNode*, TUniquePtr<FJsonTreeNode>> MoreItems;
+};
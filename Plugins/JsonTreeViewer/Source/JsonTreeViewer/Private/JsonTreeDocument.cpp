@@ -0,0 +1,296 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "JsonTreeDocument.h"
+#include "JsonTreeDocumentCache.h"
+#include "JsonTreeNodeStore.h"
+#include "JsonTreeSearchIndex.h"
+#include "JsonTreeSnapshot.h"
+#include "JsonTreeSource.h"
+#include "JsonTreeViewer.h"
+#include "JsonTreeViewerStats.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    // Smaller files parse about as fast as their snapshot would open, so they don't get one
+    constexpr int64 SnapshotMinBytes = 16 * 1024 * 1024;
+}
+
+FJsonTreeDocument::FJsonTreeDocument(const TSharedRef<const FJsonTreeNodeStore>& InNodeStore, const TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe>& InSource,
+    const TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe>& InSearchSource, const FString& InFilePath, const FJsonTreeLoadStats& InStats)
+    : NodeStore(InNodeStore)
+    , Source(InSource)
+    , SearchSource(InSource.IsValid() ? nullptr : InSearchSource)
+    , FilePath(InFilePath)
+    , Stats(InStats)
+{
+    check(!NodeStore->IsLazy() && !NodeStore->IsBuilding());
+}
+
+TSharedPtr<FJsonTreeDocument> FJsonTreeDocument::Load(const FString& JsonPathOrString, const FJsonTreeLoadOptions& Options, TFunctionRef<bool(float)> OnProgress,
+    FString& OutError, int32& OutErrorLine, int32& OutErrorColumn)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeDocument::Load");
+
+    // Every view reads a shared store, so none of them may build children in it
+    FJsonTreeLoadOptions EagerOptions = Options;
+    EagerOptions.bLazyChildren = false;
+    FLoadedTree Tree;
+    if (!LoadStore(JsonPathOrString, EagerOptions, true, OnProgress, Tree, OutError, OutErrorLine, OutErrorColumn))
+    {
+        return nullptr;
+    }
+
+    const bool bRetainSource = Options.RetainSource != EJsonTreeRetainSource::None;
+    return MakeShared<FJsonTreeDocument>(Tree.NodeStore.ToSharedRef(), bRetainSource ? Tree.Source : nullptr,
+        Options.bBuildSearchIndex ? Tree.Source : nullptr, Tree.FilePath, Tree.Stats);
+}
+
+bool FJsonTreeDocument::LoadTree(const FString& JsonPathOrString, const FJsonTreeLoadOptions& Options, TFunctionRef<bool(float)> OnProgress,
+    FLoadedTree& OutTree, FString& OutError, int32& OutErrorLine, int32& OutErrorColumn)
+{
+    return LoadStore(JsonPathOrString, Options, false, OnProgress, OutTree, OutError, OutErrorLine, OutErrorColumn);
+}
+
+bool FJsonTreeDocument::LoadStore(const FString& JsonPathOrString, const FJsonTreeLoadOptions& Options, bool bShared, TFunctionRef<bool(float)> OnProgress,
+    FLoadedTree& OutTree, FString& OutError, int32& OutErrorLine, int32& OutErrorColumn)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeDocument::LoadTree");
+    FJsonTreeLoadStats& LoadStats = OutTree.Stats;
+    OutTree.Source = OpenSource(JsonPathOrString, OutTree.FilePath, LoadStats, OutError);
+    const TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe>& LoadedSource = OutTree.Source;
+    if (!LoadedSource.IsValid() || !OnProgress(0.1f))
+    {
+        return false;
+    }
+
+    // A large file that was loaded before may have a snapshot of its tree to map instead
+    const double ParseStart = FPlatformTime::Seconds();
+    const bool bSnapshotted = Options.bUseSnapshot && !OutTree.FilePath.IsEmpty() && LoadedSource->Num() >= SnapshotMinBytes;
+    TSharedPtr<FJsonTreeNodeStore>& LoadedStore = OutTree.NodeStore;
+    FJsonTreeSnapshotStamp SnapshotStamp;
+    if (bSnapshotted)
+    {
+        SnapshotStamp = FJsonTreeSnapshotStamp::Make(JsonPathOrString, *LoadedSource);
+        LoadedStore = FJsonTreeSnapshot::Load(JsonPathOrString, SnapshotStamp);
+        LoadStats.bFromSnapshot = LoadedStore.IsValid();
+    }
+
+    // Validation and building happen in the same pass, so the text is only read once
+    bool bParsed = LoadStats.bFromSnapshot;
+    if (!bParsed)
+    {
+        const bool bLazy = Options.bLazyChildren && Options.RetainSource != EJsonTreeRetainSource::None;
+        LoadedStore = MakeShared<FJsonTreeNodeStore>();
+        bParsed = LoadedStore->Build(LoadedSource.ToSharedRef(), bLazy, Options.bParallelBuild, [&OnProgress](float ParseProgress)
+        {
+            return OnProgress(0.1f + 0.9f * ParseProgress);
+        }, OutError, OutErrorLine, OutErrorColumn);
+
+        // A shared store is written as it is; one of the caller's own may build lazy children or be
+        // patched while the snapshot is written, so the worker builds another from the text
+        if (bParsed && bSnapshotted)
+        {
+            const TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> RebuildSource = bShared ? nullptr : LoadedSource;
+            FJsonTreeSnapshot::SaveAsync(LoadedStore.ToSharedRef(), RebuildSource, JsonPathOrString, SnapshotStamp);
+        }
+    }
+    LoadStats.ParseMs = (FPlatformTime::Seconds() - ParseStart) * 1000.0;
+
+    if (!bParsed)
+    {
+        if (!OutError.IsEmpty())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Failed to parse JSON (%s) at line %d, column %d! Aborting!"), *OutError, OutErrorLine, OutErrorColumn);
+        }
+        LoadedStore.Reset();
+        return false;
+    }
+    if (OutTree.FilePath.IsEmpty())
+    {
+        UE_LOG(LogTemp, Log, TEXT("This appears to be a valid JSON string..."));
+    }
+    LoadStats.Nodes = LoadedStore->Num();
+    return true;
+}
+
+TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> FJsonTreeDocument::OpenSource(const FString& JsonPathOrString, FString& OutFilePath, FJsonTreeLoadStats& OutStats, FString& OutError)
+{
+    // Determine if the input is a file path or raw JSON string
+    const bool bJsonText = IsJsonText(JsonPathOrString);
+    TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> OpenedSource;
+    if (!bJsonText && FPaths::FileExists(JsonPathOrString))
+    {
+        // The file is mapped rather than read and widened to TCHAR; the parser works on its UTF-8 bytes in place
+        JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeSource::FromFile");
+        const double ReadStart = FPlatformTime::Seconds();
+        OpenedSource = FJsonTreeSource::FromFile(JsonPathOrString);
+        if (!OpenedSource.IsValid())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Failed to read the file: %s"), *JsonPathOrString);
+            OutError = FString::Printf(TEXT("Failed to read the file: %s"), *JsonPathOrString);
+            return nullptr;
+        }
+        OutStats.ReadMs = (FPlatformTime::Seconds() - ReadStart) * 1000.0;
+        OutFilePath = JsonPathOrString;
+    }
+    else
+    {
+        if (!bJsonText)
+        {
+            UE_LOG(LogTemp, Log, TEXT("This does not look like a valid file path: %s\nChecking if it is a JSON string..."), *JsonPathOrString);
+        }
+        OpenedSource = FJsonTreeSource::FromString(JsonPathOrString);
+    }
+    OutStats.Bytes = OpenedSource->Num();
+    return OpenedSource;
+}
+
+bool FJsonTreeDocument::IsJsonText(const FString& JsonPathOrString)
+{
+    // Raw JSON text opens with '{' or '[', so there's no point asking the file system about it
+    const TCHAR* FirstChar = *JsonPathOrString;
+    while (FChar::IsWhitespace(*FirstChar))
+    {
+        ++FirstChar;
+    }
+    return *FirstChar == TEXT('{') || *FirstChar == TEXT('[');
+}
+
+void FJsonTreeDocument::SetSearchIndex(const TSharedPtr<FJsonTreeSearchIndex, ESPMode::ThreadSafe>& InSearchIndex)
+{
+    check(IsInGameThread());
+
+    SearchIndex = InSearchIndex;
+}
+
+SIZE_T FJsonTreeDocument::GetAllocatedSize() const
+{
+    SIZE_T Size = NodeStore->GetAllocatedSize();
+
+    // A mapped file is backed by the file itself rather than by memory of ours
+    const TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe>& Text = GetSearchSource();
+    if (Text.IsValid() && !Text->IsMapped())
+    {
+        Size += SIZE_T(Text->Num());
+    }
+    if (SearchIndex.IsValid())
+    {
+        Size += SearchIndex->GetAllocatedSize();
+    }
+    return Size;
+}
+
+UJsonTreeDocument* UJsonTreeDocument::LoadJsonTreeDocument(const FString& JsonPathOrString, EJsonTreeRetainSource RetainSource)
+{
+    const FJsonTreeLoadOptions Options = MakeLoadOptions(RetainSource);
+    const FJsonTreeDocumentKey Key = FJsonTreeDocumentKey::Make(JsonPathOrString, Options);
+    FJsonTreeDocumentCache& Cache = FJsonTreeViewerModule::Get().GetDocumentCache();
+    if (const TSharedPtr<FJsonTreeDocument> Cached = Cache.Find(Key))
+    {
+        return Wrap(Cached, FString(), 0, 0);
+    }
+
+    FString Error;
+    int32 ErrorLine = 0;
+    int32 ErrorColumn = 0;
+    const TSharedPtr<FJsonTreeDocument> Document = FJsonTreeDocument::Load(JsonPathOrString, Options, [](float) { return true; }, Error, ErrorLine, ErrorColumn);
+    if (Document.IsValid())
+    {
+        Cache.Add(Key, Document.ToSharedRef());
+    }
+    return Wrap(Document, Error, ErrorLine, ErrorColumn);
+}
+
+void UJsonTreeDocument::LoadJsonTreeDocumentAsync(const FString& JsonPathOrString, FOnJsonTreeDocumentLoaded OnLoaded, EJsonTreeRetainSource RetainSource)
+{
+    const FJsonTreeLoadOptions Options = MakeLoadOptions(RetainSource);
+    const FJsonTreeDocumentKey Key = FJsonTreeDocumentKey::Make(JsonPathOrString, Options);
+    if (const TSharedPtr<FJsonTreeDocument> Cached = FJsonTreeViewerModule::Get().GetDocumentCache().Find(Key))
+    {
+        AsyncTask(ENamedThreads::GameThread, [OnLoaded, Cached]()
+        {
+            OnLoaded.ExecuteIfBound(Wrap(Cached, FString(), 0, 0));
+        });
+        return;
+    }
+
+    Async(EAsyncExecution::ThreadPool, [JsonPathOrString, OnLoaded, Options, Key]()
+    {
+        FString Error;
+        int32 ErrorLine = 0;
+        int32 ErrorColumn = 0;
+        const TSharedPtr<FJsonTreeDocument> Document = FJsonTreeDocument::Load(JsonPathOrString, Options, [](float) { return true; }, Error, ErrorLine, ErrorColumn);
+
+        // The cache and UObjects both belong to the game thread
+        AsyncTask(ENamedThreads::GameThread, [OnLoaded, Key, Document, Error, ErrorLine, ErrorColumn]()
+        {
+            if (Document.IsValid())
+            {
+                FJsonTreeViewerModule::Get().GetDocumentCache().Add(Key, Document.ToSharedRef());
+            }
+            OnLoaded.ExecuteIfBound(Wrap(Document, Error, ErrorLine, ErrorColumn));
+        });
+    });
+}
+
+UJsonTreeDocument* UJsonTreeDocument::Create(const TSharedRef<FJsonTreeDocument>& Document)
+{
+    return Wrap(Document, FString(), 0, 0);
+}
+
+FString UJsonTreeDocument::GetLoadError(int32& Line, int32& Column) const
+{
+    Line = LoadErrorLine;
+    Column = LoadErrorColumn;
+    return LoadError;
+}
+
+FJsonTreeLoadStats UJsonTreeDocument::GetLoadStats() const
+{
+    return Document.IsValid() ? Document->GetLoadStats() : FJsonTreeLoadStats();
+}
+
+FJsonTreeLoadOptions UJsonTreeDocument::MakeLoadOptions(EJsonTreeRetainSource RetainSource)
+{
+    FJsonTreeLoadOptions Options;
+    Options.RetainSource = RetainSource;
+    return Options;
+}
+
+UJsonTreeDocument* UJsonTreeDocument::Wrap(const TSharedPtr<FJsonTreeDocument>& Document, const FString& Error, int32 ErrorLine, int32 ErrorColumn)
+{
+    UJsonTreeDocument* Object = NewObject<UJsonTreeDocument>();
+    Object->Document = Document;
+    Object->LoadError = Error;
+    Object->LoadErrorLine = ErrorLine;
+    Object->LoadErrorColumn = ErrorColumn;
+    return Object;
+}
@@ -0,0 +1,117 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "JsonTreeDocumentCache.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Hash/xxhash.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    TAutoConsoleVariable<int32> CVarDocumentCacheMB(
+        TEXT("JsonTreeViewer.DocumentCacheMB"),
+        256,
+        TEXT("Megabytes of parsed JSON documents kept for reuse by other widgets and widget rebuilds. 0 disables the cache."));
+}
+
+FJsonTreeDocumentKey FJsonTreeDocumentKey::Make(const FString& JsonPathOrString, const FJsonTreeLoadOptions& Options)
+{
+    FJsonTreeDocumentKey Key;
+    Key.bRetainSource = Options.RetainSource != EJsonTreeRetainSource::None;
+
+    const bool bJsonText = FJsonTreeDocument::IsJsonText(JsonPathOrString);
+    const FFileStatData Stat = bJsonText ? FFileStatData() : IFileManager::Get().GetStatData(*JsonPathOrString);
+    if (Stat.bIsValid && !Stat.bIsDirectory)
+    {
+        Key.FilePath = FPaths::ConvertRelativePathToFull(JsonPathOrString);
+        Key.Timestamp = Stat.ModificationTime;
+        Key.Size = Stat.FileSize;
+    }
+    else
+    {
+        Key.Size = JsonPathOrString.Len();
+        Key.TextHash = FXxHash64::HashBuffer(*JsonPathOrString, JsonPathOrString.Len() * sizeof(TCHAR)).Hash;
+    }
+    return Key;
+}
+
+TSharedPtr<FJsonTreeDocument> FJsonTreeDocumentCache::Find(const FJsonTreeDocumentKey& Key)
+{
+    check(IsInGameThread());
+
+    const int32 Index = Entries.IndexOfByPredicate([&Key](const FEntry& Entry) { return Entry.Key == Key; });
+    if (Index == INDEX_NONE)
+    {
+        return nullptr;
+    }
+
+    FEntry Entry = MoveTemp(Entries[Index]);
+    Entries.RemoveAt(Index);
+    return Entries.Add_GetRef(MoveTemp(Entry)).Document;
+}
+
+void FJsonTreeDocumentCache::Add(const FJsonTreeDocumentKey& Key, const TSharedRef<FJsonTreeDocument>& Document)
+{
+    check(IsInGameThread());
+
+    Entries.RemoveAll([&Key](const FEntry& Entry) { return Entry.Key == Key; });
+    Entries.Add({ Key, Document });
+    Trim();
+}
+
+void FJsonTreeDocumentCache::Empty()
+{
+    Entries.Empty();
+}
+
+SIZE_T FJsonTreeDocumentCache::GetAllocatedSize() const
+{
+    SIZE_T Size = Entries.GetAllocatedSize();
+    for (const FEntry& Entry : Entries)
+    {
+        Size += Entry.Document->GetAllocatedSize();
+    }
+    return Size;
+}
+
+void FJsonTreeDocumentCache::Trim()
+{
+    const SIZE_T Budget = SIZE_T(FMath::Max(CVarDocumentCacheMB.GetValueOnGameThread(), 0)) * 1024 * 1024;
+
+    SIZE_T Size = 0;
+    int32 NumKept = 0;
+    for (int32 Index = Entries.Num() - 1; Index >= 0; --Index, ++NumKept)
+    {
+        Size += Entries[Index].Document->GetAllocatedSize();
+        if (Size > Budget)
+        {
+            break;
+        }
+    }
+    Entries.RemoveAt(0, Entries.Num() - NumKept);
+}
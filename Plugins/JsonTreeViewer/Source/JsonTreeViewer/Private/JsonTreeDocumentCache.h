@@ -0,0 +1,89 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JsonTreeDocument.h"
+
+// Identifies a loaded document: a file at a given size and modification time, or the text of a
+// JSON string, plus the load settings that change what gets built
+struct FJsonTreeDocumentKey
+{
+    FString FilePath;           // Full path of the file, empty for a JSON string
+    FDateTime Timestamp;
+    int64 Size = 0;             // File size, or the length of the JSON string
+    uint64 TextHash = 0;        // Hash of the JSON string, 0 for a file
+    bool bRetainSource = false;
+
+    // Key of a file path or JSON string loaded with these settings; stats the file
+    static FJsonTreeDocumentKey Make(const FString& JsonPathOrString, const FJsonTreeLoadOptions& Options);
+
+    bool operator==(const FJsonTreeDocumentKey& Other) const
+    {
+        return Size == Other.Size && TextHash == Other.TextHash && bRetainSource == Other.bRetainSource
+            && Timestamp == Other.Timestamp && FilePath == Other.FilePath;
+    }
+};
+
+/**
+ * FJsonTreeDocumentCache
+ *
+ * Documents parsed by any widget or UJsonTreeDocument, kept so that widgets opening the same file
+ * or string, and widgets rebuilt by UMG, skip reading and parsing it again. Once the cached
+ * documents take more than JsonTreeViewer.DocumentCacheMB, the least recently used ones are
+ * released (widgets and documents still holding them keep them alive). Only used on the game thread.
+ */
+class FJsonTreeDocumentCache
+{
+public:
+    // Cached document with this key, which becomes the most recently used; null if there is none
+    TSharedPtr<FJsonTreeDocument> Find(const FJsonTreeDocumentKey& Key);
+
+    // Cache a document, replacing any with the same key, then trim the cache to its budget
+    void Add(const FJsonTreeDocumentKey& Key, const TSharedRef<FJsonTreeDocument>& Document);
+
+    // Release every cached document
+    void Empty();
+
+    // Bytes held by the cached documents
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    struct FEntry
+    {
+        FJsonTreeDocumentKey Key;
+        TSharedRef<FJsonTreeDocument> Document;
+    };
+
+    // Drop the least recently used entries until the rest fit the budget. Search indexes are added
+    // to documents after they are cached, so document sizes are asked afresh each time
+    void Trim();
+
+    // Least recently used first. The budget keeps this short, so lookups just walk it.
+    TArray<FEntry> Entries;
+};
@@ -0,0 +1,83 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include "JsonTreeExpansion.h"
+
+FJsonTreeExpansion FJsonTreeExpansion::Save(const STreeView<const FJsonTreeNode*>& TreeView)
+{
+    FJsonTreeExpansion Expansion;
+    TreeView.GetExpandedItems(Expansion.Items);
+    for (const FJsonTreeNode* Item : Expansion.Items)
+    {
+        // Only containers can be expanded, and they know their own index
+        if (!Item->IsDead() && Item->IsContainer())
+        {
+            Expansion.Containers.Add(Item->Container.Self);
+        }
+    }
+    Expansion.ScrollOffset = TreeView.GetScrollOffset();
+    return Expansion;
+}
+
+void FJsonTreeExpansion::Restore(STreeView<const FJsonTreeNode*>& TreeView) const
+{
+    for (const FJsonTreeNode* Item : Items)
+    {
+        if (!Item->IsDead())
+        {
+            TreeView.SetItemExpansion(Item, true);
+        }
+    }
+}
+
+void FJsonTreeExpansion::RestoreByPath(STreeView<const FJsonTreeNode*>& TreeView, const FJsonTreeNodeStore& OldStore, FJsonTreeNodeStore& NewStore) const
+{
+    TreeView.ClearExpandedItems();
+    for (const FJsonTreeNode* Item : Items)
+    {
+        if (Item->IsDead())
+        {
+            continue;
+        }
+        const uint32 Index = NewStore.FindMatchingNode(OldStore, *Item);
+        if (Index != FJsonTreeNodeStore::InvalidIndex)
+        {
+            TreeView.SetItemExpansion(&NewStore.GetNode(Index), true);
+        }
+    }
+}
+
+void FJsonTreeExpansion::RestoreByRemap(STreeView<const FJsonTreeNode*>& TreeView, const FJsonTreeNodeStore& Store, const TArray<uint32>& Remap) const
+{
+    TreeView.ClearExpandedItems();
+    for (const uint32 Index : Containers)
+    {
+        if (Remap[Index] != FJsonTreeNodeStore::InvalidIndex)
+        {
+            TreeView.SetItemExpansion(&Store.GetNode(Remap[Index]), true);
+        }
+    }
+}
@@ -0,0 +1,60 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JsonTreeNodeStore.h"
+#include "Widgets/Views/STreeView.h"
+
+/**
+ * FJsonTreeExpansion
+ *
+ * Which items of a tree view are expanded and how far it is scrolled, saved before the nodes the
+ * items point to are replaced or moved, so it can be carried over to their counterparts.
+ */
+struct FJsonTreeExpansion
+{
+    // Expanded items as they were saved, valid only as long as their store hasn't moved them
+    TSet<const FJsonTreeNode*> Items;
+
+    // Node index of every expanded container that was alive, which a Compact remaps
+    TArray<uint32> Containers;
+
+    float ScrollOffset = 0.f;
+
+    static FJsonTreeExpansion Save(const STreeView<const FJsonTreeNode*>& TreeView);
+
+    // Expand the live saved items again, in a tree view that lists the same nodes
+    void Restore(STreeView<const FJsonTreeNode*>& TreeView) const;
+
+    // Expand the counterparts in NewStore of the saved items of OldStore. Expansion is tracked by
+    // item, so each one is found by path, building the lazy children along it.
+    void RestoreByPath(STreeView<const FJsonTreeNode*>& TreeView, const FJsonTreeNodeStore& OldStore, FJsonTreeNodeStore& NewStore) const;
+
+    // Expand the saved containers where a Compact of their store moved them
+    void RestoreByRemap(STreeView<const FJsonTreeNode*>& TreeView, const FJsonTreeNodeStore& Store, const TArray<uint32>& Remap) const;
+};
@@ -0,0 +1,76 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include "JsonTreeFilterView.h"
+#include "JsonTreeViewerStats.h"
+
+FJsonTreeFilterView::FJsonTreeFilterView(const FJsonTreeNodeFilter& InFilter)
+    : Filter(InFilter)
+{
+}
+
+void FJsonTreeFilterView::Apply(const FJsonTreeNodeStore& Store)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeFilterView::Apply");
+    Reset();
+    Store.FilterNodes(Filter, Result);
+    Store.GetFilteredTopLevelItems(Result, TopLevelItems);
+    bApplied = true;
+}
+
+void FJsonTreeFilterView::Reset()
+{
+    bApplied = false;
+    Result = FJsonTreeFilterResult();
+    TopLevelItems.Reset();
+    NumChildren.Reset();
+}
+
+bool FJsonTreeFilterView::IsFilteredItem(const FJsonTreeNodeStore& Store, const FJsonTreeNode& Item) const
+{
+    return bApplied && Item.IsContainer() && !Store.IsWithinMatch(Item, Result);
+}
+
+uint32 FJsonTreeFilterView::GetChildren(const FJsonTreeNodeStore& Store, const FJsonTreeNode& Item, TArray<const FJsonTreeNode*>& OutChildren, uint32 MaxChildren, bool bCountAll)
+{
+    const uint32* NumCounted = NumChildren.Find(&Item);
+    const uint32 NumFound = Store.GetFilteredChildren(Item, Result, OutChildren, MaxChildren, bCountAll && !NumCounted);
+    if (NumCounted)
+    {
+        return *NumCounted;
+    }
+    if (bCountAll)
+    {
+        NumChildren.Add(&Item, NumFound);
+    }
+    return NumFound;
+}
+
+SIZE_T FJsonTreeFilterView::GetAllocatedSize() const
+{
+    return sizeof(*this) + Filter.KeyPattern.GetAllocatedSize() + Result.Matches.GetAllocatedSize() + Result.Shown.GetAllocatedSize()
+        + TopLevelItems.GetAllocatedSize() + NumChildren.GetAllocatedSize();
+}
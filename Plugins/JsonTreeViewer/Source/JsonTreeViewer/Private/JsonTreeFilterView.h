@@ -0,0 +1,79 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JsonTreeNodeStore.h"
+
+/**
+ * FJsonTreeFilterView
+ *
+ * A widget's filter and its result over the node store the widget shows. The result only reads
+ * the store, so widgets showing the same shared document each keep their own filter view of it.
+ */
+class FJsonTreeFilterView
+{
+public:
+    explicit FJsonTreeFilterView(const FJsonTreeNodeFilter& InFilter);
+
+    const FJsonTreeNodeFilter& GetFilter() const { return Filter; }
+
+    // Test every node of a fully built store and list the top-level items the filter shows
+    void Apply(const FJsonTreeNodeStore& Store);
+
+    // Drop the result, e.g. while the store it was computed over is replaced or still being built
+    void Reset();
+
+    // Whether Apply has computed a result since the last Reset
+    bool IsApplied() const { return bApplied; }
+
+    int32 GetNumMatches() const { return bApplied ? Result.NumMatches : 0; }
+
+    // Top-level items the filter shows, listed by the tree in place of all of them
+    const TArray<const FJsonTreeNode*>& GetTopLevelItems() const { return TopLevelItems; }
+
+    // Whether the children of an item are listed through the filter rather than all of them
+    bool IsFilteredItem(const FJsonTreeNodeStore& Store, const FJsonTreeNode& Item) const;
+
+    // Append the first MaxChildren children of an item the filter shows. Returns how many it shows
+    // in all when bCountAll, which walks the whole child list once per item and is then remembered;
+    // otherwise how many were appended, or the remembered count if there is one
+    uint32 GetChildren(const FJsonTreeNodeStore& Store, const FJsonTreeNode& Item, TArray<const FJsonTreeNode*>& OutChildren, uint32 MaxChildren, bool bCountAll);
+
+    // Bytes held by the result
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    FJsonTreeNodeFilter Filter;
+
+    bool bApplied = false;
+    FJsonTreeFilterResult Result;
+    TArray<const FJsonTreeNode*> TopLevelItems;
+
+    // Number of children the filter shows, by item, counted when an item is first expanded
+    TMap<const FJsonTreeNode*, uint32> NumChildren;
+};
@@ -0,0 +1,125 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "JsonTreeLocation.h"
+
+bool FJsonTreeLocation::Parse(const FString& Path, TArray<FString>& OutTokens)
+{
+    if (Path.IsEmpty() || Path[0] == TEXT('/'))
+    {
+        Path.ParseIntoArray(OutTokens, TEXT("/"), false);
+        if (OutTokens.Num() > 0)
+        {
+            // The leading slash leaves an empty token in front
+            OutTokens.RemoveAt(0);
+        }
+        for (FString& Token : OutTokens)
+        {
+            Token.ReplaceInline(TEXT("~1"), TEXT("/"), ESearchCase::CaseSensitive);
+            Token.ReplaceInline(TEXT("~0"), TEXT("~"), ESearchCase::CaseSensitive);
+        }
+        return true;
+    }
+
+    if (Path[0] != TEXT('$'))
+    {
+        return false;
+    }
+    for (int32 Pos = 1; Pos < Path.Len();)
+    {
+        if (Path[Pos] == TEXT('.'))
+        {
+            // Dot notation runs up to the next step; wildcards and recursive descent aren't supported
+            const int32 Start = ++Pos;
+            while (Pos < Path.Len() && Path[Pos] != TEXT('.') && Path[Pos] != TEXT('['))
+            {
+                ++Pos;
+            }
+            if (Pos == Start || Path[Start] == TEXT('*'))
+            {
+                return false;
+            }
+            OutTokens.Add(Path.Mid(Start, Pos - Start));
+        }
+        else if (Path[Pos] == TEXT('[') && Pos + 1 < Path.Len() && (Path[Pos + 1] == TEXT('\'') || Path[Pos + 1] == TEXT('"')))
+        {
+            const TCHAR Quote = Path[Pos + 1];
+            FString& Token = OutTokens.AddDefaulted_GetRef();
+            for (Pos += 2; Pos < Path.Len() && Path[Pos] != Quote; ++Pos)
+            {
+                if (Path[Pos] == TEXT('\\') && Pos + 1 < Path.Len())
+                {
+                    ++Pos;
+                }
+                Token.AppendChar(Path[Pos]);
+            }
+            if (Pos + 1 >= Path.Len() || Path[Pos + 1] != TEXT(']'))
+            {
+                return false;
+            }
+            Pos += 2;
+        }
+        else if (Path[Pos] == TEXT('['))
+        {
+            const int32 Start = ++Pos;
+            while (Pos < Path.Len() && FChar::IsDigit(Path[Pos]))
+            {
+                ++Pos;
+            }
+            if (Pos == Start || Pos >= Path.Len() || Path[Pos] != TEXT(']'))
+            {
+                return false;
+            }
+            OutTokens.Add(Path.Mid(Start, Pos - Start));
+            ++Pos;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FJsonTreeLocation::ParseArrayIndex(const FString& Token, uint32& OutIndex)
+{
+    if (Token.IsEmpty() || Token.Len() > 10 || (Token.Len() > 1 && Token[0] == TEXT('0')))
+    {
+        return false;
+    }
+    uint64 Index = 0;
+    for (const TCHAR Char : Token)
+    {
+        if (!FChar::IsDigit(Char))
+        {
+            return false;
+        }
+        Index = Index * 10 + (Char - TEXT('0'));
+    }
+    OutIndex = uint32(FMath::Min<uint64>(Index, MAX_uint32));
+    return true;
+}
@@ -0,0 +1,48 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FJsonTreeLocation
+ *
+ * Paths to a node as they are given to FindNodeAtPath and NavigateToPath: a JSON Pointer
+ * (RFC 6901) or a JSONPath made of member names and indices, split into the reference tokens a
+ * lookup follows one level at a time.
+ */
+class FJsonTreeLocation
+{
+public:
+    // Split a JSON Pointer or a JSONPath into its reference tokens. Returns false for anything
+    // else, including JSONPath wildcards and recursive descent.
+    static bool Parse(const FString& Path, TArray<FString>& OutTokens);
+
+    // Array index of a reference token: decimal digits without leading zeros
+    static bool ParseArrayIndex(const FString& Token, uint32& OutIndex);
+};
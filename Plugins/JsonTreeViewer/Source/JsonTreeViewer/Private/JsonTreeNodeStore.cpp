@@ -0,0 +1,1759 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "JsonTreeNodeStore.h"
+#include "JsonTreeParser.h"
+#include "JsonTreeScanner.h"
+#include "JsonTreeSource.h"
+#include "JsonTreeViewerStats.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+namespace
+{
+    // Start of every string pool; the offsets match TrueOffset, FalseOffset and NullOffset
+    const ANSICHAR SharedStrings[] = "\0true\0false\0null";
+
+    bool StringsEqual(FUtf8StringView A, FUtf8StringView B)
+    {
+        // Element keys are empty views without a pool pointer
+        return A.Len() == B.Len() && (A.Len() == 0 || FMemory::Memcmp(A.GetData(), B.GetData(), A.Len()) == 0);
+    }
+
+    // Whether a node's value has text of its own in the pool, rather than one of the shared texts or a number
+    bool HasPooledValue(const FJsonTreeNode& Node)
+    {
+        return Node.HasTextValue() && Node.Value.Offset >= UE_ARRAY_COUNT(SharedStrings);
+    }
+
+    uint32 HashString(FUtf8StringView String)
+    {
+        return FCrc::MemCrc32(String.GetData(), String.Len());
+    }
+
+    // Eager builds of documents this large are pre-scanned to size the store up front
+    constexpr int64 PrescanMinBytes = 1024 * 1024;
+
+    // Documents smaller than this are built on the calling thread
+    constexpr int64 ParallelBuildMinBytes = 4 * 1024 * 1024;
+
+    // Smallest slice handed to a worker thread
+    constexpr int64 MinSliceBytes = 256 * 1024;
+}
+
+struct FJsonTreeNodeStore::FSteppedBuild
+{
+    FSteppedBuild(FJsonTreeNodeStore& Store, const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe>& InSource)
+        : Source(InSource)
+        , Parser(Store, InSource->GetData(), InSource->Num())
+    {
+    }
+
+    // Holds the text being parsed, which an eager build doesn't keep in the store
+    TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe> Source;
+    FJsonTreeParser Parser;
+
+    // Last top-level item handed out by GetNewTopLevelItems
+    uint32 LastReported = InvalidIndex;
+
+    // A streamed build only hands the parser text up to ParseEnd, just past the last byte that ends a
+    // token; ScanEnd is how far the text has been scanned for that, and whether it ends in a string
+    bool bStream = false;
+    int64 ParseEnd = 0;
+    int64 ScanEnd = 0;
+    bool bInString = false;
+    bool bEscaped = false;
+};
+
+FJsonTreeNodeStore::FJsonTreeNodeStore()
+    : NumNodes(0)
+    , SnapshotStrings(nullptr)
+    , WastedStringBytes(0)
+    , NumDeadNodes(0)
+    , LastRecord(InvalidIndex)
+    , ReportedNodes(0)
+    , ReportedStringBytes(0)
+    , ReportedArenaBytes(0)
+{
+    Reset();
+}
+
+FJsonTreeNodeStore::~FJsonTreeNodeStore()
+{
+    FJsonTreeViewerStats::AddStoreMemory(-int64(ReportedNodes), -int64(ReportedStringBytes), -int64(ReportedArenaBytes));
+}
+
+void FJsonTreeNodeStore::Reset()
+{
+    Blocks.Empty();
+    BlockAllocations.Empty();
+    NumNodes = 0;
+    Snapshot.Reset();
+    SnapshotStrings = nullptr;
+    Strings.Reset();
+    Strings.Append(reinterpret_cast<const UTF8CHAR*>(SharedStrings), UE_ARRAY_COUNT(SharedStrings));
+    WastedStringBytes = 0;
+    Names.Reset();
+    NumDeadNodes = 0;
+    LastRecord = InvalidIndex;
+    ChildIndices.Reset();
+    Source.Reset();
+    SteppedBuild.Reset();
+    UpdateMemoryStats();
+}
+
+void FJsonTreeNodeStore::ResetToRecords()
+{
+    Reset();
+    AddNode(EJson::Array, InvalidIndex, 0);
+}
+
+bool FJsonTreeNodeStore::AppendRecord(const uint8* Data, int64 Size, FString& OutError, int32& OutErrorColumn)
+{
+    check(NumNodes > 0 && GetNode(0).GetType() == EJson::Array);
+
+    const uint32 NumNodesBefore = NumNodes;
+    const int64 NumStringsBefore = Strings.Num();
+
+    ChildIndices.Remove(0);
+
+    FJsonTreeParser Parser(*this, Data, Size);
+    if (Parser.ParseRecord(0, LastRecord))
+    {
+        UpdateMemoryStats();
+        return true;
+    }
+
+    // Roll back whatever the partial record added; nothing outside this store can point at it yet
+    FJsonTreeNode& Root = GetNode(0);
+    uint32 NumChildren = 0;
+    for (uint32 Child = Root.FirstChild; Child != InvalidIndex && Child < NumNodesBefore; Child = GetNode(Child).NextSibling)
+    {
+        ++NumChildren;
+    }
+    Root.NumChildren = NumChildren;
+    if (LastRecord == InvalidIndex)
+    {
+        Root.FirstChild = InvalidIndex;
+    }
+    else
+    {
+        GetNode(LastRecord).NextSibling = InvalidIndex;
+    }
+    NumNodes = NumNodesBefore;
+    Strings.SetNum(NumStringsBefore);
+
+    OutError = Parser.GetError();
+    OutErrorColumn = Parser.GetErrorColumn();
+    return false;
+}
+
+bool FJsonTreeNodeStore::AppendRecords(const FJsonTreeNodeStore& From, TArray<const FJsonTreeNode*>& OutAppended, FString& OutError)
+{
+    check(NumNodes > 0 && GetNode(0).GetType() == EJson::Array);
+    if (From.NumNodes == 0)
+    {
+        return true;
+    }
+
+    // The records bring at most From's strings and names along; check they fit before adding any,
+    // dropping the text of removed records first if that makes the difference
+    if (!HasRoomFor(From) && WastedStringBytes > 0)
+    {
+        CompactStrings();
+    }
+    if (!HasRoomFor(From))
+    {
+        OutError = Strings.Num() + From.Strings.Num() > MaxStringBytes ? TEXT("Strings need more than 4 GB") : TEXT("Member names need more than 4 GB");
+        return false;
+    }
+
+    ChildIndices.Remove(0);
+    for (uint32 FromChild = From.GetNode(0).FirstChild; FromChild != InvalidIndex; FromChild = From.GetNode(FromChild).NextSibling)
+    {
+        // Records keep counting up as old ones are dropped, so each keeps its index for good
+        const uint32 RecordIndex = LastRecord == InvalidIndex ? 0 : GetNode(LastRecord).Key + 1;
+        const uint32 Child = AddNode(EJson::None, 0, 0);
+        GetNode(Child).Value = { 0, 0 };
+        if (!ReplaceNode(Child, From, FromChild))
+        {
+            // Not linked yet, so the record is simply never shown
+            MarkDead(Child);
+            OutError = TEXT("Strings need more than 4 GB");
+            UpdateMemoryStats();
+            return false;
+        }
+        GetNode(Child).Key = RecordIndex;
+        LinkChild(0, Child, LastRecord);
+        OutAppended.Add(&GetNode(Child));
+    }
+    UpdateMemoryStats();
+    return true;
+}
+
+bool FJsonTreeNodeStore::HasRoomFor(const FJsonTreeNodeStore& From) const
+{
+    return Strings.Num() + From.Strings.Num() <= MaxStringBytes && Names.NumBytes() + From.Names.NumBytes() <= MaxStringBytes;
+}
+
+void FJsonTreeNodeStore::RemoveFirstRecords(int32 Count)
+{
+    ChildIndices.Remove(0);
+    FJsonTreeNode& Root = GetNode(0);
+    for (; Count > 0 && Root.FirstChild != InvalidIndex; --Count)
+    {
+        const uint32 Child = Root.FirstChild;
+        Root.FirstChild = GetNode(Child).NextSibling;
+        --Root.NumChildren;
+        MarkDead(Child);
+    }
+    if (Root.FirstChild == InvalidIndex)
+    {
+        LastRecord = InvalidIndex;
+    }
+}
+
+void FJsonTreeNodeStore::Compact(TArray<uint32>& OutRemap)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeNodeStore::Compact");
+    CompactStrings();
+    ChildIndices.Reset();
+
+    OutRemap.Init(InvalidIndex, NumNodes);
+    uint32 NumLive = 0;
+    for (uint32 Index = 0; Index < NumNodes; ++Index)
+    {
+        if (!GetNode(Index).IsDead())
+        {
+            OutRemap[Index] = NumLive++;
+        }
+    }
+
+    auto RemapIndex = [&OutRemap](uint32 Index)
+    {
+        return Index == InvalidIndex ? InvalidIndex : OutRemap[Index];
+    };
+
+    // Names only used by dead nodes are dropped along with them
+    FNameTable NewNames;
+    TArray<TUniquePtr<FJsonTreeNode[]>> NewBlocks;
+    for (uint32 Index = 0; Index < NumNodes; ++Index)
+    {
+        const uint32 NewIndex = OutRemap[Index];
+        if (NewIndex == InvalidIndex)
+        {
+            continue;
+        }
+        if ((NewIndex & BlockMask) == 0)
+        {
+            NewBlocks.Add(MakeUnique<FJsonTreeNode[]>(NodesPerBlock));
+        }
+
+        // Live nodes only ever link to live nodes, since removal unlinks a node before marking it dead
+        FJsonTreeNode& NewNode = NewBlocks[NewIndex >> BlockShift][NewIndex & BlockMask];
+        NewNode = GetNode(Index);
+        NewNode.Parent = RemapIndex(NewNode.Parent);
+        NewNode.FirstChild = RemapIndex(NewNode.FirstChild);
+        NewNode.NextSibling = RemapIndex(NewNode.NextSibling);
+        if (!NewNode.HasIndexKey())
+        {
+            NewNode.Key = NewNames.Add(Names.Get(NewNode.Key));
+        }
+        if (NewNode.IsContainer())
+        {
+            NewNode.Container.Self = NewIndex;
+        }
+    }
+
+    BlockAllocations = MoveTemp(NewBlocks);
+    Blocks.Reset();
+    for (const TUniquePtr<FJsonTreeNode[]>& Block : BlockAllocations)
+    {
+        Blocks.Add(Block.Get());
+    }
+    Names = MoveTemp(NewNames);
+    NumNodes = NumLive;
+    NumDeadNodes = 0;
+    LastRecord = RemapIndex(LastRecord);
+    UpdateMemoryStats();
+}
+
+bool FJsonTreeNodeStore::Build(const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe>& InSource, bool bLazy, bool bParallel, TFunctionRef<bool(float)> OnProgress,
+    FString& OutError, int32& OutErrorLine, int32& OutErrorColumn)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeNodeStore::Build");
+    Reset();
+
+    // Pending containers remember 32-bit offsets, so larger documents are built up front
+    if (InSource->Num() > int64(MAX_uint32))
+    {
+        bLazy = false;
+    }
+
+    // A lazy build only creates the top level, which leaves nothing worth spreading over threads
+    // and too little to be worth sizing for
+    if (!bLazy && InSource->Num() >= PrescanMinBytes)
+    {
+        FJsonTreeScanCounts Counts;
+        if (bParallel && InSource->Num() >= ParallelBuildMinBytes)
+        {
+            bool bAborted = false;
+            if (BuildParallel(InSource->GetData(), InSource->Num(), OnProgress, Counts, bAborted))
+            {
+                UpdateMemoryStats();
+                return true;
+            }
+            if (bAborted)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            FJsonTreeScanner::Scan(InSource->GetData(), InSource->Num(), Counts);
+        }
+        Reserve(Counts);
+    }
+
+    // The root is depth 0 and top-level items depth 1, which is as deep as a lazy build goes
+    FJsonTreeParser Parser(*this, InSource->GetData(), InSource->Num());
+    if (!Parser.ParseDocument(bLazy ? 1 : MAX_int32, OnProgress))
+    {
+        OutError = Parser.GetError();
+        OutErrorLine = Parser.GetErrorLine();
+        OutErrorColumn = Parser.GetErrorColumn();
+        Reset();
+        return false;
+    }
+
+    if (bLazy)
+    {
+        Source = InSource;
+    }
+    UpdateMemoryStats();
+    return true;
+}
+
+void FJsonTreeNodeStore::BeginBuild(const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe>& InSource, bool bLazy)
+{
+    Reset();
+    if (InSource->Num() > int64(MAX_uint32))
+    {
+        bLazy = false;
+    }
+
+    // Completed top-level items can be expanded before the build is done, which parses their children
+    if (bLazy)
+    {
+        Source = InSource;
+    }
+    SteppedBuild = MakeUnique<FSteppedBuild>(*this, InSource);
+    SteppedBuild->Parser.BeginDocument(bLazy ? 1 : MAX_int32);
+}
+
+void FJsonTreeNodeStore::BeginStreamBuild(const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe>& InSource, bool bLazy)
+{
+    // A stream never outgrows the 32-bit offsets of lazy containers
+    BeginBuild(InSource, bLazy);
+    SteppedBuild->bStream = true;
+    SteppedBuild->Parser.SetInput(SteppedBuild->Source->GetData(), 0, false);
+}
+
+bool FJsonTreeNodeStore::AppendBuildInput(TConstArrayView<uint8> Bytes)
+{
+    check(SteppedBuild.IsValid() && SteppedBuild->bStream);
+    FSteppedBuild& Build = *SteppedBuild;
+    if (!Build.Source->AppendStream(Bytes))
+    {
+        return false;
+    }
+
+    // Outside strings, whitespace and structural characters end whatever token comes before them,
+    // and a closing quote ends its string, so the parser never sees the front half of a token
+    const uint8* Data = Build.Source->GetData();
+    const int64 Size = Build.Source->Num();
+    for (int64 Pos = Build.ScanEnd; Pos < Size; ++Pos)
+    {
+        const uint8 C = Data[Pos];
+        if (Build.bInString)
+        {
+            if (Build.bEscaped)
+            {
+                Build.bEscaped = false;
+            }
+            else if (C == '\\')
+            {
+                Build.bEscaped = true;
+            }
+            else if (C == '"')
+            {
+                Build.bInString = false;
+                Build.ParseEnd = Pos + 1;
+            }
+        }
+        else if (C == '"')
+        {
+            Build.bInString = true;
+        }
+        else if (C == ',' || C == ':' || C == '{' || C == '}' || C == '[' || C == ']' || C == ' ' || C == '\n' || C == '\r' || C == '\t')
+        {
+            Build.ParseEnd = Pos + 1;
+        }
+    }
+    Build.ScanEnd = Size;
+    Build.Parser.SetInput(Data, Build.ParseEnd, false);
+    return true;
+}
+
+void FJsonTreeNodeStore::EndBuildInput()
+{
+    check(SteppedBuild.IsValid() && SteppedBuild->bStream);
+    FSteppedBuild& Build = *SteppedBuild;
+    Build.Source->FinishStream();
+    Build.Parser.SetInput(Build.Source->GetData(), Build.Source->Num(), true);
+}
+
+EJsonTreeBuildStep FJsonTreeNodeStore::ContinueBuild(double MaxSeconds, FString& OutError, int32& OutErrorLine, int32& OutErrorColumn)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeNodeStore::ContinueBuild");
+    check(SteppedBuild.IsValid());
+
+    FJsonTreeParser& Parser = SteppedBuild->Parser;
+    const EJsonTreeBuildStep Step = Parser.ContinueDocument(MaxSeconds);
+    if (Step == EJsonTreeBuildStep::Failed)
+    {
+        OutError = Parser.GetError();
+        OutErrorLine = Parser.GetErrorLine();
+        OutErrorColumn = Parser.GetErrorColumn();
+        Reset();
+        return Step;
+    }
+
+    if (Step == EJsonTreeBuildStep::Done)
+    {
+        SteppedBuild.Reset();
+    }
+    UpdateMemoryStats();
+    return Step;
+}
+
+float FJsonTreeNodeStore::GetBuildProgress() const
+{
+    return SteppedBuild.IsValid() ? SteppedBuild->Parser.GetProgress() : 1.f;
+}
+
+void FJsonTreeNodeStore::GetNewTopLevelItems(TArray<const FJsonTreeNode*>& InOutItems)
+{
+    if (!SteppedBuild.IsValid() || NumNodes == 0 || !GetNode(0).IsContainer())
+    {
+        return;
+    }
+
+    // The last linked item is still being parsed while anything below the root is open
+    const bool bLastComplete = SteppedBuild->Parser.GetOpenDepth() <= 1;
+    uint32& LastReported = SteppedBuild->LastReported;
+    uint32 Next = LastReported == InvalidIndex ? GetNode(0).FirstChild : GetNode(LastReported).NextSibling;
+    while (Next != InvalidIndex)
+    {
+        const FJsonTreeNode& Item = GetNode(Next);
+        if (Item.NextSibling == InvalidIndex && !bLastComplete)
+        {
+            break;
+        }
+        InOutItems.Add(&Item);
+        LastReported = Next;
+        Next = Item.NextSibling;
+    }
+}
+
+bool FJsonTreeNodeStore::BuildParallel(const uint8* Data, int64 Size, TFunctionRef<bool(float)> OnProgress, FJsonTreeScanCounts& OutCounts, bool& bOutAborted)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeNodeStore::BuildParallel");
+    const int32 NumWorkers = FMath::Max(FPlatformMisc::NumberOfWorkerThreadsToSpawn(), 1);
+
+    // A few slices per worker keeps them all busy when the top-level items differ in size
+    int64 RootOpen = 0;
+    TArray<FJsonTreeTextSlice> Slices;
+    if (!FJsonTreeScanner::ScanSlices(Data, Size, FMath::Max(Size / (NumWorkers * 4), MinSliceBytes), RootOpen, Slices, OutCounts) || Slices.Num() < 2)
+    {
+        return false;
+    }
+    const bool bObject = Data[RootOpen] == '{';
+    const EJson RootType = bObject ? EJson::Object : EJson::Array;
+
+    // Each slice is parsed into a store of its own under a stand-in root
+    struct FSlice
+    {
+        FJsonTreeNodeStore Store;
+        uint32 LastChild = InvalidIndex;
+        bool bParsed = false;
+    };
+    TArray<TUniquePtr<FSlice>> SliceStores;
+    for (int32 Index = 0; Index < Slices.Num(); ++Index)
+    {
+        SliceStores.Add(MakeUnique<FSlice>());
+    }
+
+    std::atomic<bool> bAborted(false);
+    std::atomic<int64> BytesParsed(0);
+    FCriticalSection ProgressLock;
+
+    ParallelFor(Slices.Num(), [&](int32 Index)
+    {
+        if (bAborted)
+        {
+            return;
+        }
+
+        JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeNodeStore::ParseSlice");
+        FSlice& Slice = *SliceStores[Index];
+        Slice.Store.Reserve(Slices[Index].Counts);
+        Slice.Store.AddNode(RootType, InvalidIndex, 0);
+        FJsonTreeParser Parser(Slice.Store, Data, Slices[Index].End);
+        Slice.bParsed = Parser.ParseSlice(0, bObject, Slices[Index].Begin, Slice.LastChild, [&bAborted](float)
+        {
+            return !bAborted;
+        });
+        if (!Slice.bParsed)
+        {
+            // A syntax error stops the other slices; the serial parse reports it with its exact position
+            bAborted = true;
+            return;
+        }
+
+        // The callback isn't thread-safe, so slices take turns reporting
+        const int64 Done = BytesParsed += Slices[Index].End - Slices[Index].Begin;
+        FScopeLock Lock(&ProgressLock);
+        if (!bAborted && !OnProgress(float(double(Done) / double(Size))))
+        {
+            bOutAborted = true;
+            bAborted = true;
+        }
+    });
+
+    if (bAborted)
+    {
+        return false;
+    }
+
+    // Slices are appended in document order. Their nodes and strings are relocated by their
+    // offsets in the merged store, which are known up front, so the copies run in parallel too.
+    const uint32 SharedBytes = UE_ARRAY_COUNT(SharedStrings);
+    TArray<uint32> NodeBases;
+    TArray<int64> StringBases;
+    TArray<uint32> ElementBases;
+    uint32 NumMergedNodes = 1;
+    int64 NumMergedStrings = Strings.Num();
+    uint32 NumMergedElements = 0;
+    for (const TUniquePtr<FSlice>& Slice : SliceStores)
+    {
+        NodeBases.Add(NumMergedNodes);
+        StringBases.Add(NumMergedStrings);
+        ElementBases.Add(NumMergedElements);
+        NumMergedNodes += Slice->Store.NumNodes - 1;
+        NumMergedStrings += Slice->Store.Strings.Num() - SharedBytes;
+        NumMergedElements += Slice->Store.GetNode(0).NumChildren;
+    }
+    if (NumMergedStrings > MaxStringBytes)
+    {
+        // The serial parse stops where the pool runs out and reports it
+        return false;
+    }
+
+    // Each slice interned the names it saw; map its ids to ids of the merged table
+    TArray<TArray<uint32>> NameRemaps;
+    NameRemaps.SetNum(SliceStores.Num());
+    for (int32 Index = 0; Index < SliceStores.Num(); ++Index)
+    {
+        const FNameTable& SliceNames = SliceStores[Index]->Store.Names;
+        NameRemaps[Index].SetNumUninitialized(SliceNames.Num());
+        for (int32 Id = 0; Id < SliceNames.Num(); ++Id)
+        {
+            NameRemaps[Index][Id] = Names.Add(SliceNames.Get(uint32(Id)));
+            if (NameRemaps[Index][Id] == InvalidIndex)
+            {
+                Names.Reset();
+                return false;
+            }
+        }
+    }
+
+    const uint32 Root = AddNode(RootType, InvalidIndex, 0);
+    GetNode(Root).Container.Source = uint32(RootOpen);
+    AddNodesUninitialized(NumMergedNodes - 1);
+    Strings.SetNumUninitialized(NumMergedStrings);
+
+    ParallelFor(SliceStores.Num(), [&](int32 Index)
+    {
+        JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeNodeStore::MergeSlice");
+        const FJsonTreeNodeStore& From = SliceStores[Index]->Store;
+        const uint32 NodeBase = NodeBases[Index] - 1;
+        const uint32 StringBase = uint32(StringBases[Index]) - SharedBytes;
+        const uint32 ElementBase = ElementBases[Index];
+        const TArray<uint32>& NameRemap = NameRemaps[Index];
+
+        auto RebaseNode = [NodeBase](uint32 FromIndex)
+        {
+            return FromIndex == InvalidIndex || FromIndex == 0 ? FromIndex : FromIndex + NodeBase;
+        };
+        auto RebaseString = [StringBase, SharedBytes](uint32 Offset)
+        {
+            return Offset < SharedBytes ? Offset : Offset + StringBase;
+        };
+
+        if (From.Strings.Num() > int64(SharedBytes))
+        {
+            FMemory::Memcpy(&Strings[StringBases[Index]], &From.Strings[SharedBytes], From.Strings.Num() - SharedBytes);
+        }
+
+        for (uint32 FromIndex = 1; FromIndex < From.NumNodes; ++FromIndex)
+        {
+            FJsonTreeNode& Node = GetNode(FromIndex + NodeBase);
+            Node = From.GetNode(FromIndex);
+            if (!Node.HasIndexKey())
+            {
+                Node.Key = NameRemap[Node.Key];
+            }
+            else if (Node.Parent == 0)
+            {
+                // Elements of the root count on from the previous slices
+                Node.Key += ElementBase;
+            }
+            Node.Parent = RebaseNode(Node.Parent);
+            Node.FirstChild = RebaseNode(Node.FirstChild);
+            Node.NextSibling = RebaseNode(Node.NextSibling);
+            if (Node.IsContainer())
+            {
+                Node.Container.Self = FromIndex + NodeBase;
+            }
+            else if (Node.HasTextValue())
+            {
+                Node.Value.Offset = RebaseString(Node.Value.Offset);
+            }
+        }
+    });
+
+    // Chain each slice's top-level items onto the previous slice's
+    uint32 LastChild = InvalidIndex;
+    for (int32 Index = 0; Index < SliceStores.Num(); ++Index)
+    {
+        const FSlice& Slice = *SliceStores[Index];
+        const FJsonTreeNode& SliceRoot = Slice.Store.GetNode(0);
+        if (SliceRoot.FirstChild == InvalidIndex)
+        {
+            continue;
+        }
+
+        const uint32 First = SliceRoot.FirstChild + NodeBases[Index] - 1;
+        if (LastChild == InvalidIndex)
+        {
+            GetNode(Root).FirstChild = First;
+        }
+        else
+        {
+            GetNode(LastChild).NextSibling = First;
+        }
+        GetNode(Root).NumChildren += SliceRoot.NumChildren;
+        LastChild = Slice.LastChild + NodeBases[Index] - 1;
+    }
+
+    // The serial parse pages a root array when it closes; none of the slices saw all of it
+    PageElements(Root);
+    return true;
+}
+
+bool FJsonTreeNodeStore::Patch(FJsonTreeNodeStore& NewStore, FJsonTreePatchResult& OutResult, FString& OutError)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeNodeStore::Patch");
+    checkf(!IsSnapshot(), TEXT("Snapshot stores are mapped read-only and can't be patched"));
+    if (NumNodes == 0 || NewStore.NumNodes == 0)
+    {
+        return true;
+    }
+    ChildIndices.Reset();
+
+    // Copied values come from NewStore's pool, so dropping replaced text first keeps room for them
+    if (!HasRoomFor(NewStore) && WastedStringBytes > 0)
+    {
+        CompactStrings();
+    }
+
+    // Pending nodes are adopted with their offset into the new text rather than parsed, so the
+    // new text is what they have to be built from from now on
+    const bool bAdoptPending = NewStore.Source.IsValid();
+
+    // Walk matched pairs of nodes, starting with the roots
+    TArray<TPair<uint32, uint32>> Pairs;
+    Pairs.Emplace(0, 0);
+    while (Pairs.Num() > 0)
+    {
+        const TPair<uint32, uint32> Pair = Pairs.Pop();
+        FJsonTreeNode& Node = GetNode(Pair.Key);
+        FJsonTreeNode& NewNode = NewStore.GetNode(Pair.Value);
+
+        bool bCopied = true;
+        if (Node.Type != NewNode.Type || Node.IsPage() != NewNode.IsPage())
+        {
+            // Same place, different kind of value: the node keeps its address but takes over the new contents
+            bCopied = ReplaceNode(Pair.Key, NewStore, Pair.Value);
+            OutResult.ChangedNodes.Add(&Node);
+            OutResult.bStructureChanged = true;
+        }
+        else if (!Node.IsContainer())
+        {
+            // Numbers compare by their bits, so 0 and -0 differ just as their text does
+            const bool bSameValue = Node.HasTextValue()
+                ? StringsEqual(GetValue(Node), NewStore.GetValue(NewNode))
+                : Node.IsInteger() == NewNode.IsInteger() && Node.Integer == NewNode.Integer;
+            if (!bSameValue)
+            {
+                bCopied = CopyValue(Pair.Key, NewStore, Pair.Value);
+                OutResult.ChangedNodes.Add(&Node);
+            }
+        }
+        else if (Node.HasPendingChildren())
+        {
+            // Nothing below this node has been shown yet, so there's nothing to keep either
+            if (bAdoptPending && NewNode.HasPendingChildren())
+            {
+                Node.Container.Source = NewNode.Container.Source;
+            }
+            else
+            {
+                bCopied = ReplaceNode(Pair.Key, NewStore, Pair.Value);
+            }
+        }
+        else
+        {
+            bCopied = PatchChildren(Pair.Key, NewStore, Pair.Value, Pairs, OutResult);
+        }
+
+        if (!bCopied)
+        {
+            OutError = Strings.Num() + NewStore.Strings.Num() > MaxStringBytes ? TEXT("Strings need more than 4 GB") : TEXT("Member names need more than 4 GB");
+            UpdateMemoryStats();
+            return false;
+        }
+    }
+
+    Source = NewStore.Source;
+    if (WastedStringBytes > SIZE_T(Strings.Num() / 2))
+    {
+        CompactStrings();
+    }
+    UpdateMemoryStats();
+    return true;
+}
+
+bool FJsonTreeNodeStore::PatchChildren(uint32 Index, FJsonTreeNodeStore& From, uint32 FromIndex, TArray<TPair<uint32, uint32>>& OutPairs, FJsonTreePatchResult& OutResult)
+{
+    From.MaterializeChildren(FromIndex);
+    FJsonTreeNode& FromNode = From.GetNode(FromIndex);
+
+    TArray<uint32> OldChildren;
+    OldChildren.Reserve(GetNode(Index).NumChildren);
+    for (uint32 Child = GetNode(Index).FirstChild; Child != InvalidIndex; Child = GetNode(Child).NextSibling)
+    {
+        OldChildren.Add(Child);
+    }
+
+    TArray<uint32> NewChildren;
+    NewChildren.Reserve(FromNode.NumChildren);
+    for (uint32 Child = FromNode.FirstChild; Child != InvalidIndex; Child = From.GetNode(Child).NextSibling)
+    {
+        NewChildren.Add(Child);
+    }
+
+    // Most updates keep members in the same order, so match position by position while the names agree
+    TArray<uint32> Children;
+    Children.Reserve(NewChildren.Num());
+    int32 Matched = 0;
+    while (Matched < OldChildren.Num() && Matched < NewChildren.Num()
+        && StringsEqual(GetKey(GetNode(OldChildren[Matched])), From.GetKey(From.GetNode(NewChildren[Matched]))))
+    {
+        Children.Add(OldChildren[Matched]);
+        OutPairs.Emplace(OldChildren[Matched], NewChildren[Matched]);
+        ++Matched;
+    }
+
+    if (Matched < OldChildren.Num() || Matched < NewChildren.Num())
+    {
+        // Match the rest by member name and occurrence; the key packs the name id with the occurrence.
+        // A new name that this store has never seen can't match anything.
+        TMap<uint32, int32> Occurrences;
+        TMap<uint64, int32> OldByKey;
+        for (int32 Position = Matched; Position < OldChildren.Num(); ++Position)
+        {
+            const uint32 Name = GetNameId(GetNode(OldChildren[Position]));
+            const int32 Occurrence = Occurrences.FindOrAdd(Name)++;
+            OldByKey.Add((uint64(Name) << 32) | uint32(Occurrence), Position);
+        }
+
+        TBitArray<> OldMatched(false, OldChildren.Num());
+        Occurrences.Reset();
+        for (int32 Position = Matched; Position < NewChildren.Num(); ++Position)
+        {
+            const uint32 Name = Names.Find(From.GetKey(From.GetNode(NewChildren[Position])));
+            const int32* OldPosition = nullptr;
+            if (Name != InvalidIndex)
+            {
+                const int32 Occurrence = Occurrences.FindOrAdd(Name)++;
+                OldPosition = OldByKey.Find((uint64(Name) << 32) | uint32(Occurrence));
+            }
+            if (OldPosition && !OldMatched[*OldPosition])
+            {
+                OldMatched[*OldPosition] = true;
+                Children.Add(OldChildren[*OldPosition]);
+                OutPairs.Emplace(OldChildren[*OldPosition], NewChildren[Position]);
+            }
+            else
+            {
+                // New member: add a node and copy its contents over. If either runs out of room, the
+                // node is left out and the old child list stays as it was.
+                const uint32 Key = CopyKey(From, From.GetNode(NewChildren[Position]));
+                if (Key == InvalidIndex)
+                {
+                    return false;
+                }
+                const uint32 Child = AddNode(EJson::None, Index, Key);
+                GetNode(Child).Value = { 0, 0 };
+                if (!ReplaceNode(Child, From, NewChildren[Position]))
+                {
+                    MarkDead(Child);
+                    return false;
+                }
+                Children.Add(Child);
+            }
+        }
+
+        for (int32 Position = Matched; Position < OldChildren.Num(); ++Position)
+        {
+            if (!OldMatched[Position])
+            {
+                MarkDead(OldChildren[Position]);
+            }
+        }
+    }
+
+    if (Children == OldChildren)
+    {
+        return true;
+    }
+
+    // Relink the children in the new document order
+    FJsonTreeNode& Node = GetNode(Index);
+    Node.FirstChild = InvalidIndex;
+    Node.NumChildren = 0;
+    uint32 LastChild = InvalidIndex;
+    for (const uint32 Child : Children)
+    {
+        GetNode(Child).NextSibling = InvalidIndex;
+        LinkChild(Index, Child, LastChild);
+    }
+    OutResult.bStructureChanged = true;
+    return true;
+}
+
+bool FJsonTreeNodeStore::ReplaceNode(uint32 Index, const FJsonTreeNodeStore& From, uint32 FromIndex)
+{
+    FJsonTreeNode& Node = GetNode(Index);
+    const FJsonTreeNode& FromNode = From.GetNode(FromIndex);
+
+    // Drop the old contents
+    for (uint32 Child = Node.FirstChild; Child != InvalidIndex; Child = GetNode(Child).NextSibling)
+    {
+        MarkDead(Child);
+    }
+    if (HasPooledValue(Node))
+    {
+        WastedStringBytes += Node.Value.Length + 1;
+    }
+    Node.FirstChild = InvalidIndex;
+    Node.NumChildren = 0;
+    Node.Type = FromNode.Type;
+    Node.Flags = FromNode.Flags;
+    if (FromNode.HasIndexKey())
+    {
+        // Matched by position, so this only changes when an element becomes a page or the other way round
+        Node.Key = FromNode.Key;
+    }
+
+    if (!FromNode.IsContainer())
+    {
+        Node.Value.Offset = 0;
+        Node.Value.Length = 0;
+        return CopyValue(Index, From, FromIndex);
+    }
+
+    Node.Container.Self = Index;
+    Node.Container.Source = FromNode.Container.Source;
+    return FromNode.HasPendingChildren() || CopyChildren(From, FromIndex, Index);
+}
+
+bool FJsonTreeNodeStore::CopyValue(uint32 Index, const FJsonTreeNodeStore& From, uint32 FromIndex)
+{
+    const FJsonTreeNode& FromNode = From.GetNode(FromIndex);
+    FJsonTreeNode& Node = GetNode(Index);
+    if (HasPooledValue(Node))
+    {
+        WastedStringBytes += Node.Value.Length + 1;
+    }
+
+    if (!FromNode.HasTextValue())
+    {
+        Node.Integer = FromNode.Integer;
+        Node.Flags = (Node.Flags & ~EJsonTreeNodeFlags::Integer) | (FromNode.Flags & EJsonTreeNodeFlags::Integer);
+        return true;
+    }
+
+    // The shared texts sit at the same offsets in every pool. A string that doesn't fit leaves the
+    // value empty.
+    const uint32 Offset = FromNode.Value.Offset < UE_ARRAY_COUNT(SharedStrings) ? FromNode.Value.Offset : AddString(From.GetValue(FromNode));
+    if (Offset == InvalidIndex)
+    {
+        Node.Value = { 0, 0 };
+        return false;
+    }
+    Node.Value.Offset = Offset;
+    Node.Value.Length = FromNode.Value.Length;
+    return true;
+}
+
+bool FJsonTreeNodeStore::CopyChildren(const FJsonTreeNodeStore& From, uint32 FromIndex, uint32 ToIndex)
+{
+    // Explicit stack, as deep documents would overflow a recursive copy
+    TArray<TPair<uint32, uint32>, TInlineAllocator<64>> Stack;
+    Stack.Emplace(FromIndex, ToIndex);
+    while (Stack.Num() > 0)
+    {
+        const TPair<uint32, uint32> Pair = Stack.Pop();
+        uint32 LastChild = InvalidIndex;
+        for (uint32 FromChild = From.GetNode(Pair.Key).FirstChild; FromChild != InvalidIndex; FromChild = From.GetNode(FromChild).NextSibling)
+        {
+            const FJsonTreeNode& FromNode = From.GetNode(FromChild);
+            const uint32 Key = CopyKey(From, FromNode);
+            if (Key == InvalidIndex)
+            {
+                return false;
+            }
+            const uint32 Child = AddNode(FromNode.GetType(), Pair.Value, Key);
+            LinkChild(Pair.Value, Child, LastChild);
+
+            FJsonTreeNode& Node = GetNode(Child);
+            Node.Flags = FromNode.Flags;
+            if (!FromNode.IsContainer())
+            {
+                if (!CopyValue(Child, From, FromChild))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                Node.Container.Source = FromNode.Container.Source;
+                if (!FromNode.HasPendingChildren())
+                {
+                    Stack.Emplace(FromChild, Child);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+void FJsonTreeNodeStore::MarkDead(uint32 Index)
+{
+    TArray<uint32, TInlineAllocator<64>> Stack;
+    Stack.Add(Index);
+    while (Stack.Num() > 0)
+    {
+        FJsonTreeNode& Node = GetNode(Stack.Pop());
+        Node.Flags |= EJsonTreeNodeFlags::Dead;
+        ++NumDeadNodes;
+
+        if (HasPooledValue(Node))
+        {
+            WastedStringBytes += Node.Value.Length + 1;
+        }
+        for (uint32 Child = Node.FirstChild; Child != InvalidIndex; Child = GetNode(Child).NextSibling)
+        {
+            Stack.Add(Child);
+        }
+    }
+}
+
+void FJsonTreeNodeStore::CompactStrings()
+{
+    TArray64<UTF8CHAR> OldStrings = MoveTemp(Strings);
+    Strings.Reset();
+    Strings.Append(reinterpret_cast<const UTF8CHAR*>(SharedStrings), UE_ARRAY_COUNT(SharedStrings));
+
+    // The live strings all fitted in the old pool, so they always fit in the new one
+    auto Relocate = [this, &OldStrings](uint32 Offset, uint32 Length)
+    {
+        return Offset < UE_ARRAY_COUNT(SharedStrings) ? Offset : AddString(FUtf8StringView(&OldStrings[Offset], Length));
+    };
+
+    for (uint32 Index = 0; Index < NumNodes; ++Index)
+    {
+        FJsonTreeNode& Node = GetNode(Index);
+        if (Node.IsDead())
+        {
+            if (Node.HasTextValue())
+            {
+                Node.Value.Offset = 0;
+                Node.Value.Length = 0;
+            }
+            continue;
+        }
+
+        if (Node.HasTextValue())
+        {
+            Node.Value.Offset = Relocate(Node.Value.Offset, Node.Value.Length);
+        }
+    }
+    WastedStringBytes = 0;
+}
+
+uint32 FJsonTreeNodeStore::FindMatchingNode(const FJsonTreeNodeStore& Other, const FJsonTreeNode& OtherNode) const
+{
+    if (NumNodes == 0)
+    {
+        return InvalidIndex;
+    }
+
+    // Path from the root down to OtherNode
+    TArray<const FJsonTreeNode*, TInlineAllocator<32>> Path;
+    for (const FJsonTreeNode* PathNode = &OtherNode; PathNode->Parent != InvalidIndex; PathNode = &Other.GetNode(PathNode->Parent))
+    {
+        Path.Add(PathNode);
+    }
+
+    uint32 Index = 0;
+    for (int32 Level = Path.Num() - 1; Level >= 0 && Index != InvalidIndex; --Level)
+    {
+        Index = FindMatchingChild(Index, Other, *Path[Level]);
+    }
+    return Index;
+}
+
+uint32 FJsonTreeNodeStore::FindMatchingNode(const FJsonTreeNodeStore& Other, const FJsonTreeNode& OtherNode)
+{
+    if (NumNodes == 0)
+    {
+        return InvalidIndex;
+    }
+
+    TArray<const FJsonTreeNode*, TInlineAllocator<32>> Path;
+    for (const FJsonTreeNode* PathNode = &OtherNode; PathNode->Parent != InvalidIndex; PathNode = &Other.GetNode(PathNode->Parent))
+    {
+        Path.Add(PathNode);
+    }
+
+    uint32 Index = 0;
+    for (int32 Level = Path.Num() - 1; Level >= 0 && Index != InvalidIndex; --Level)
+    {
+        // Building the children may intern the name being looked for, so it is looked up after
+        MaterializeChildren(Index);
+        Index = FindMatchingChild(Index, Other, *Path[Level]);
+    }
+    return Index;
+}
+
+uint32 FJsonTreeNodeStore::FindMatchingChild(uint32 Index, const FJsonTreeNodeStore& Other, const FJsonTreeNode& OtherNode) const
+{
+    const uint32 Name = Names.Find(Other.GetKey(OtherNode));
+    if (Name == InvalidIndex)
+    {
+        return InvalidIndex;
+    }
+
+    int32 Occurrence = Other.GetOccurrence(OtherNode);
+    for (uint32 Child = GetNode(Index).FirstChild; Child != InvalidIndex; Child = GetNode(Child).NextSibling)
+    {
+        if (GetNameId(GetNode(Child)) == Name && Occurrence-- == 0)
+        {
+            return Child;
+        }
+    }
+    return InvalidIndex;
+}
+
+uint32 FJsonTreeNodeStore::FindNodeAtPath(TConstArrayView<FJsonTreePathStep> Path) const
+{
+    uint32 Index = NumNodes > 0 ? 0 : InvalidIndex;
+    for (int32 Step = 0; Step < Path.Num() && Index != InvalidIndex; ++Step)
+    {
+        Index = FindPathChild(Index, Path[Step]);
+    }
+    return Index;
+}
+
+uint32 FJsonTreeNodeStore::FindNodeAtPath(TConstArrayView<FJsonTreePathStep> Path)
+{
+    uint32 Index = NumNodes > 0 ? 0 : InvalidIndex;
+    for (int32 Step = 0; Step < Path.Num() && Index != InvalidIndex; ++Step)
+    {
+        MaterializeChildren(Index);
+        Index = FindPathChild(Index, Path[Step]);
+    }
+    return Index;
+}
+
+uint32 FJsonTreeNodeStore::FindPathChild(uint32 Index, const FJsonTreePathStep& Step) const
+{
+    const EJson Type = GetNode(Index).GetType();
+    if (Step.bElement)
+    {
+        return Type == EJson::Array ? GetElement(Index, Step.Position) : InvalidIndex;
+    }
+    if (Type != EJson::Object)
+    {
+        return InvalidIndex;
+    }
+
+    // Names rarely repeat, so the first member with the name is looked up and the rest are walked to
+    uint32 Child = FindChild(Index, Step.Key);
+    if (Child == InvalidIndex || Step.Position == 0)
+    {
+        return Child;
+    }
+    const uint32 Name = GetNameId(GetNode(Child));
+    uint32 Occurrence = Step.Position;
+    for (Child = GetNode(Child).NextSibling; Child != InvalidIndex; Child = GetNode(Child).NextSibling)
+    {
+        if (GetNameId(GetNode(Child)) == Name && --Occurrence == 0)
+        {
+            return Child;
+        }
+    }
+    return InvalidIndex;
+}
+
+uint32 FJsonTreeNodeStore::FindChild(uint32 Index, FUtf8StringView Key) const
+{
+    // No member of the document has a name that was never interned
+    const uint32 Name = Names.Find(Key);
+    if (Name == InvalidIndex)
+    {
+        return InvalidIndex;
+    }
+
+    if (GetNode(Index).GetType() == EJson::Object)
+    {
+        if (const FChildIndex* ChildIndex = GetChildIndex(Index))
+        {
+            const int32* Position = ChildIndex->FirstWithName.Find(Name);
+            return Position ? ChildIndex->Children[*Position] : InvalidIndex;
+        }
+    }
+
+    for (uint32 Child = GetNode(Index).FirstChild; Child != InvalidIndex; Child = GetNode(Child).NextSibling)
+    {
+        if (GetNameId(GetNode(Child)) == Name)
+        {
+            return Child;
+        }
+    }
+    return InvalidIndex;
+}
+
+uint32 FJsonTreeNodeStore::GetChildAt(uint32 Index, uint32 Position) const
+{
+    if (Position >= GetNode(Index).NumChildren)
+    {
+        return InvalidIndex;
+    }
+    if (const FChildIndex* ChildIndex = GetChildIndex(Index))
+    {
+        return ChildIndex->Children[Position];
+    }
+
+    uint32 Child = GetNode(Index).FirstChild;
+    for (; Position > 0 && Child != InvalidIndex; --Position)
+    {
+        Child = GetNode(Child).NextSibling;
+    }
+    return Child;
+}
+
+uint32 FJsonTreeNodeStore::GetElement(uint32 Index, uint32 ElementIndex) const
+{
+    const uint32 FirstChild = GetNode(Index).FirstChild;
+    if (FirstChild != InvalidIndex && GetNode(FirstChild).IsPage())
+    {
+        const uint32 Page = GetChildAt(Index, ElementIndex / ArrayPageSize);
+        return Page == InvalidIndex ? InvalidIndex : GetChildAt(Page, ElementIndex % ArrayPageSize);
+    }
+    return GetChildAt(Index, ElementIndex);
+}
+
+const FJsonTreeNodeStore::FChildIndex* FJsonTreeNodeStore::GetChildIndex(uint32 Index) const
+{
+    const FJsonTreeNode& Node = GetNode(Index);
+    if (Node.NumChildren < MinIndexedChildren || Node.HasPendingChildren())
+    {
+        return nullptr;
+    }
+
+    FScopeLock Lock(&ChildIndexLock);
+    if (const TUniquePtr<FChildIndex>* Existing = ChildIndices.Find(Index))
+    {
+        return Existing->Get();
+    }
+
+    FChildIndex& ChildIndex = *ChildIndices.Add(Index, MakeUnique<FChildIndex>());
+    ChildIndex.Children.Reserve(Node.NumChildren);
+    for (uint32 Child = Node.FirstChild; Child != InvalidIndex; Child = GetNode(Child).NextSibling)
+    {
+        ChildIndex.Children.Add(Child);
+    }
+
+    // Filled back to front so a repeated name ends up with its first position
+    if (Node.GetType() == EJson::Object)
+    {
+        ChildIndex.FirstWithName.Reserve(ChildIndex.Children.Num());
+        for (int32 Position = ChildIndex.Children.Num() - 1; Position >= 0; --Position)
+        {
+            ChildIndex.FirstWithName.Add(GetNameId(GetNode(ChildIndex.Children[Position])), Position);
+        }
+    }
+    return &ChildIndex;
+}
+
+int32 FJsonTreeNodeStore::GetOccurrence(const FJsonTreeNode& Node) const
+{
+    if (Node.Parent == InvalidIndex)
+    {
+        return 0;
+    }
+
+    const uint32 Name = GetNameId(Node);
+    int32 Occurrence = 0;
+    for (uint32 Sibling = GetNode(Node.Parent).FirstChild; Sibling != InvalidIndex && &GetNode(Sibling) != &Node; Sibling = GetNode(Sibling).NextSibling)
+    {
+        if (GetNameId(GetNode(Sibling)) == Name)
+        {
+            ++Occurrence;
+        }
+    }
+    return Occurrence;
+}
+
+void FJsonTreeNodeStore::GetTopLevelItems(TArray<const FJsonTreeNode*>& OutItems) const
+{
+    OutItems.Reset();
+    if (NumNodes == 0)
+    {
+        return;
+    }
+
+    const FJsonTreeNode& Root = GetNode(0);
+    if (Root.IsContainer())
+    {
+        GetChildren(Root, OutItems);
+    }
+    else
+    {
+        OutItems.Add(&Root);
+    }
+}
+
+void FJsonTreeNodeStore::GetChildren(const FJsonTreeNode& Node, TArray<const FJsonTreeNode*>& OutChildren, uint32 MaxChildren) const
+{
+    uint32 Remaining = FMath::Min(Node.NumChildren, MaxChildren);
+    OutChildren.Reserve(OutChildren.Num() + Remaining);
+    for (uint32 Child = Node.FirstChild; Child != InvalidIndex && Remaining > 0; Child = GetNode(Child).NextSibling, --Remaining)
+    {
+        OutChildren.Add(&GetNode(Child));
+    }
+}
+
+void FJsonTreeNodeStore::MaterializeChildren(uint32 Index)
+{
+    FJsonTreeNode& Node = GetNode(Index);
+    if (!Node.HasPendingChildren() || !Source.IsValid())
+    {
+        return;
+    }
+
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeNodeStore::MaterializeChildren");
+    Node.Flags &= ~EJsonTreeNodeFlags::PendingChildren;
+
+    FJsonTreeParser Parser(*this, Source->GetData(), Source->Num());
+    Parser.ParseChildren(Index);
+    UpdateMemoryStats();
+}
+
+void FJsonTreeNodeStore::MaterializeDescendants(uint32 Index, int32 Depth)
+{
+    if (!Source.IsValid())
+    {
+        return;
+    }
+
+    TArray<TPair<uint32, int32>> Stack;
+    Stack.Emplace(Index, Depth);
+    while (Stack.Num() > 0)
+    {
+        const TPair<uint32, int32> Entry = Stack.Pop(EAllowShrinking::No);
+        MaterializeChildren(Entry.Key);
+        for (uint32 Child = GetNode(Entry.Key).FirstChild; Child != InvalidIndex; Child = GetNode(Child).NextSibling)
+        {
+            const FJsonTreeNode& ChildNode = GetNode(Child);
+            const int32 ChildDepth = ChildNode.IsPage() ? Entry.Value : Entry.Value - 1;
+            if (ChildNode.IsContainer() && ChildDepth > 0)
+            {
+                Stack.Emplace(Child, ChildDepth);
+            }
+        }
+    }
+}
+
+void FJsonTreeNodeStore::MaterializeAll()
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeNodeStore::MaterializeAll");
+    if (!Source.IsValid() || IsBuilding())
+    {
+        return;
+    }
+
+    // Nodes built here are appended, so the loop gets to their own pending children as well
+    for (uint32 Index = 0; Index < NumNodes; ++Index)
+    {
+        const FJsonTreeNode& Node = GetNode(Index);
+        if (Node.HasPendingChildren() && !Node.IsDead())
+        {
+            MaterializeChildren(Index);
+        }
+    }
+
+    // Nothing is left to parse from the text
+    Source.Reset();
+}
+
+void FJsonTreeNodeStore::FilterNodes(const FJsonTreeNodeFilter& Filter, FJsonTreeFilterResult& OutResult) const
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeNodeStore::FilterNodes");
+
+    // A name is tested once, however many members have it
+    const bool bKeyPattern = !Filter.KeyPattern.IsEmpty();
+    TBitArray<> NameMatches;
+    if (bKeyPattern)
+    {
+        NameMatches.Init(false, Names.Num());
+        for (int32 Id = 0; Id < Names.Num(); ++Id)
+        {
+            const FUtf8StringView Name = Names.Get(Id);
+            const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Name.GetData()), Name.Len());
+            NameMatches[Id] = FString(Converted.Length(), Converted.Get()).MatchesWildcard(Filter.KeyPattern);
+        }
+    }
+
+    // Each block of nodes fills its own words of the bit array, so the blocks need no locking
+    OutResult.Matches.Init(false, int32(NumNodes));
+    OutResult.Shown.Init(false, int32(NumNodes));
+    const int32 NumBlocks = int32((NumNodes + NodesPerBlock - 1) >> BlockShift);
+    TArray<int32> BlockMatches;
+    BlockMatches.SetNumZeroed(NumBlocks);
+    ParallelFor(NumBlocks, [&](int32 Block)
+    {
+        const uint32 First = uint32(Block) << BlockShift;
+        const uint32 Last = FMath::Min(First + NodesPerBlock, NumNodes);
+        for (uint32 Index = First; Index < Last; ++Index)
+        {
+            // A container root isn't an item, and pages only group elements
+            const FJsonTreeNode& Node = GetNode(Index);
+            if (Node.IsDead() || Node.IsPage() || (Node.Parent == InvalidIndex && Node.IsContainer()))
+            {
+                continue;
+            }
+            if (Filter.TypeMask != 0 && (Filter.TypeMask & (1u << Node.Type)) == 0)
+            {
+                continue;
+            }
+            if (Filter.bNumberRange && (Node.GetType() != EJson::Number || Node.GetNumber() < Filter.MinNumber || Node.GetNumber() > Filter.MaxNumber))
+            {
+                continue;
+            }
+            if (bKeyPattern && (Node.HasIndexKey() || !NameMatches[Node.Key]))
+            {
+                continue;
+            }
+            OutResult.Matches[Index] = true;
+            ++BlockMatches[Block];
+        }
+    });
+
+    // Walking up stops at the first shown ancestor, so every node is marked at most once
+    OutResult.NumMatches = 0;
+    for (int32 Block = 0; Block < NumBlocks; ++Block)
+    {
+        OutResult.NumMatches += BlockMatches[Block];
+    }
+    for (TConstSetBitIterator<> It(OutResult.Matches); It; ++It)
+    {
+        for (uint32 Index = uint32(It.GetIndex()); Index != InvalidIndex && !OutResult.Shown[Index]; Index = GetNode(Index).Parent)
+        {
+            OutResult.Shown[Index] = true;
+        }
+    }
+}
+
+uint32 FJsonTreeNodeStore::GetFilteredChildren(const FJsonTreeNode& Node, const FJsonTreeFilterResult& Filter, TArray<const FJsonTreeNode*>& OutChildren, uint32 MaxChildren, bool bCountAll) const
+{
+    uint32 NumShown = 0;
+    for (uint32 Child = Node.FirstChild; Child != InvalidIndex; Child = GetNode(Child).NextSibling)
+    {
+        if (!Filter.Shown[Child])
+        {
+            continue;
+        }
+        if (NumShown < MaxChildren)
+        {
+            OutChildren.Add(&GetNode(Child));
+        }
+        else if (!bCountAll)
+        {
+            break;
+        }
+        ++NumShown;
+    }
+    return NumShown;
+}
+
+void FJsonTreeNodeStore::GetFilteredTopLevelItems(const FJsonTreeFilterResult& Filter, TArray<const FJsonTreeNode*>& OutItems) const
+{
+    OutItems.Reset();
+    if (NumNodes == 0)
+    {
+        return;
+    }
+
+    const FJsonTreeNode& Root = GetNode(0);
+    if (Root.IsContainer())
+    {
+        GetFilteredChildren(Root, Filter, OutItems, MAX_uint32, false);
+    }
+    else if (Filter.Shown[0])
+    {
+        OutItems.Add(&Root);
+    }
+}
+
+bool FJsonTreeNodeStore::IsWithinMatch(const FJsonTreeNode& Node, const FJsonTreeFilterResult& Filter) const
+{
+    for (uint32 Index = Node.Container.Self; Index != InvalidIndex; Index = GetNode(Index).Parent)
+    {
+        if (Filter.Matches[Index])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+SIZE_T FJsonTreeNodeStore::GetAllocatedSize() const
+{
+    // A snapshot's nodes and strings are backed by the mapped file rather than by memory of ours
+    SIZE_T Size = Blocks.GetAllocatedSize()
+        + BlockAllocations.GetAllocatedSize()
+        + BlockAllocations.Num() * NodesPerBlock * sizeof(FJsonTreeNode)
+        + Strings.GetAllocatedSize()
+        + Names.GetAllocatedSize();
+
+    FScopeLock Lock(&ChildIndexLock);
+    Size += ChildIndices.GetAllocatedSize();
+    for (const TPair<uint32, TUniquePtr<FChildIndex>>& Pair : ChildIndices)
+    {
+        Size += sizeof(FChildIndex) + Pair.Value->GetAllocatedSize();
+    }
+    return Size;
+}
+
+FUtf8StringView FJsonTreeNodeStore::GetKey(const FJsonTreeNode& Node) const
+{
+    if (Node.HasIndexKey())
+    {
+        return FUtf8StringView();
+    }
+    return Names.Get(Node.Key);
+}
+
+FUtf8StringView FJsonTreeNodeStore::GetValue(const FJsonTreeNode& Node) const
+{
+    if (!Node.HasTextValue())
+    {
+        return FUtf8StringView();
+    }
+    const UTF8CHAR* Pool = Snapshot.IsValid() ? SnapshotStrings : Strings.GetData();
+    return FUtf8StringView(Pool + Node.Value.Offset, Node.Value.Length);
+}
+
+FString FJsonTreeNodeStore::GetKeyString(const FJsonTreeNode& Node) const
+{
+    if (Node.IsPage())
+    {
+        return FString::Printf(TEXT("[%u..%u]"), Node.Key, Node.Key + Node.NumChildren - 1);
+    }
+    if (Node.HasIndexKey())
+    {
+        return FString::Printf(TEXT("[%u]"), Node.Key);
+    }
+    const FUtf8StringView Key = GetKey(Node);
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Key.GetData()), Key.Len());
+    return FString(Converted.Length(), Converted.Get());
+}
+
+FString FJsonTreeNodeStore::GetValueString(const FJsonTreeNode& Node) const
+{
+    if (Node.GetType() == EJson::Number)
+    {
+        // Fractions are shown the way FJsonValue shows them, i.e. as a sanitized double
+        return Node.IsInteger() ? FString::Printf(TEXT("%lld"), Node.Integer) : FString::SanitizeFloat(Node.Number);
+    }
+
+    const FUtf8StringView Value = GetValue(Node);
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Value.GetData()), Value.Len());
+    return FString(Converted.Length(), Converted.Get());
+}
+
+FString FJsonTreeNodeStore::GetValueString(const FJsonTreeNode& Node, int32 MaxChars, int64& OutHiddenBytes) const
+{
+    OutHiddenBytes = 0;
+
+    // Every character takes at least one byte, so a value no longer than this fits whatever it holds
+    const FUtf8StringView Value = GetValue(Node);
+    if (Value.Len() <= MaxChars)
+    {
+        return GetValueString(Node);
+    }
+
+    // Characters are counted by their lead bytes; continuation bytes are 10xxxxxx
+    int32 Bytes = 0;
+    for (int32 Chars = 0; Bytes < Value.Len() && Chars < MaxChars; ++Chars)
+    {
+        ++Bytes;
+        while (Bytes < Value.Len() && (uint8(Value[Bytes]) & 0xC0) == 0x80)
+        {
+            ++Bytes;
+        }
+    }
+    OutHiddenBytes = Value.Len() - Bytes;
+
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Value.GetData()), Bytes);
+    return FString(Converted.Length(), Converted.Get());
+}
+
+uint32 FJsonTreeNodeStore::AddString(FUtf8StringView String)
+{
+    if (String.IsEmpty())
+    {
+        return 0;
+    }
+
+    if (Strings.Num() + String.Len() >= MaxStringBytes)
+    {
+        return InvalidIndex;
+    }
+    const uint32 Offset = uint32(Strings.Num());
+    Strings.Append(String.GetData(), String.Len());
+    Strings.Add(UTF8CHAR('\0'));
+    return Offset;
+}
+
+void FJsonTreeNodeStore::UpdateMemoryStats()
+{
+    const SIZE_T StringBytes = Strings.GetAllocatedSize();
+    const SIZE_T ArenaBytes = BlockAllocations.Num() * NodesPerBlock * sizeof(FJsonTreeNode);
+    FJsonTreeViewerStats::AddStoreMemory(int64(NumNodes) - int64(ReportedNodes), int64(StringBytes) - int64(ReportedStringBytes), int64(ArenaBytes) - int64(ReportedArenaBytes));
+    ReportedNodes = NumNodes;
+    ReportedStringBytes = StringBytes;
+    ReportedArenaBytes = ArenaBytes;
+}
+
+void FJsonTreeNodeStore::AddBlock()
+{
+    Blocks.Add(BlockAllocations.Add_GetRef(MakeUnique<FJsonTreeNode[]>(NodesPerBlock)).Get());
+}
+
+uint32 FJsonTreeNodeStore::AddNode(EJson Type, uint32 Parent, uint32 Key)
+{
+    if ((NumNodes & BlockMask) == 0)
+    {
+        AddBlock();
+    }
+
+    const uint32 Index = NumNodes++;
+    FJsonTreeNode& Node = GetNode(Index);
+    Node.Parent = Parent;
+    Node.FirstChild = InvalidIndex;
+    Node.NextSibling = InvalidIndex;
+    Node.NumChildren = 0;
+    Node.Key = Key;
+    Node.Type = uint8(Type);
+    Node.Flags = EJsonTreeNodeFlags::None;
+    Node.Reserved = 0;
+    Node.Container.Self = Index;
+    Node.Container.Source = InvalidIndex;
+    return Index;
+}
+
+void FJsonTreeNodeStore::Reserve(const FJsonTreeScanCounts& Counts)
+{
+    // Blocks are still allocated as nodes are added, since the node count is only an upper bound;
+    // the pool is the part that would otherwise be copied every time it grows
+    const int32 NumBlocks = int32(FMath::Min<int64>((Counts.MaxNodes + NodesPerBlock - 1) / NodesPerBlock, MAX_int32));
+    Blocks.Reserve(NumBlocks);
+    BlockAllocations.Reserve(NumBlocks);
+    Strings.Reserve(FMath::Min<int64>(Strings.Num() + Counts.StringBytes, MAX_uint32));
+}
+
+uint32 FJsonTreeNodeStore::AddNodesUninitialized(uint32 Count)
+{
+    const uint32 First = NumNodes;
+    NumNodes += Count;
+    while (uint32(Blocks.Num()) * NodesPerBlock < NumNodes)
+    {
+        AddBlock();
+    }
+    return First;
+}
+
+void FJsonTreeNodeStore::PageElements(uint32 Index)
+{
+    if (GetNode(Index).GetType() != EJson::Array || GetNode(Index).NumChildren <= ArrayPageSize)
+    {
+        return;
+    }
+
+    // The elements keep their nodes and keys; only their parent and sibling links change
+    uint32 Element = GetNode(Index).FirstChild;
+    GetNode(Index).FirstChild = InvalidIndex;
+    GetNode(Index).NumChildren = 0;
+    uint32 LastPage = InvalidIndex;
+    for (uint32 First = 0; Element != InvalidIndex; First += ArrayPageSize)
+    {
+        const uint32 Page = AddNode(EJson::Array, Index, First);
+        LinkChild(Index, Page, LastPage);
+
+        FJsonTreeNode& PageNode = GetNode(Page);
+        PageNode.Flags = EJsonTreeNodeFlags::Page;
+        PageNode.FirstChild = Element;
+        uint32 LastElement = Element;
+        for (; PageNode.NumChildren < ArrayPageSize && Element != InvalidIndex; ++PageNode.NumChildren)
+        {
+            FJsonTreeNode& ElementNode = GetNode(Element);
+            ElementNode.Parent = Page;
+            LastElement = Element;
+            Element = ElementNode.NextSibling;
+        }
+        GetNode(LastElement).NextSibling = InvalidIndex;
+    }
+}
+
+uint32 FJsonTreeNodeStore::CopyKey(const FJsonTreeNodeStore& From, const FJsonTreeNode& FromNode)
+{
+    return FromNode.HasIndexKey() ? FromNode.Key : Names.Add(From.GetKey(FromNode));
+}
+
+void FJsonTreeNodeStore::LinkChild(uint32 Parent, uint32 Child, uint32& LastChild)
+{
+    FJsonTreeNode& ParentNode = GetNode(Parent);
+    if (LastChild == InvalidIndex)
+    {
+        ParentNode.FirstChild = Child;
+    }
+    else
+    {
+        GetNode(LastChild).NextSibling = Child;
+    }
+    LastChild = Child;
+    ++ParentNode.NumChildren;
+}
+
+FJsonTreeNodeStore::FNameTable::FNameTable()
+{
+    Reset();
+}
+
+void FJsonTreeNodeStore::FNameTable::Reset()
+{
+    Text.Reset();
+    Offsets.Reset();
+    Offsets.Add(0);
+    Offsets.Add(0);
+    FirstWithHash.Reset();
+    NextWithHash.Reset();
+    NextWithHash.Add(InvalidIndex);
+}
+
+uint32 FJsonTreeNodeStore::FNameTable::Add(FUtf8StringView Name)
+{
+    const uint32 Existing = Find(Name);
+    if (Existing != InvalidIndex)
+    {
+        return Existing;
+    }
+
+    if (Text.Num() + Name.Len() > MaxStringBytes)
+    {
+        return InvalidIndex;
+    }
+
+    const uint32 Id = uint32(Num());
+    uint32& First = FirstWithHash.FindOrAdd(HashString(Name), InvalidIndex);
+    NextWithHash.Add(First);
+    First = Id;
+    Text.Append(Name.GetData(), Name.Len());
+    Offsets.Add(uint32(Text.Num()));
+    return Id;
+}
+
+uint32 FJsonTreeNodeStore::FNameTable::Find(FUtf8StringView Name) const
+{
+    if (Name.IsEmpty())
+    {
+        return 0;
+    }
+
+    const uint32* First = FirstWithHash.Find(HashString(Name));
+    for (uint32 Id = First ? *First : InvalidIndex; Id != InvalidIndex; Id = NextWithHash[Id])
+    {
+        if (StringsEqual(Get(Id), Name))
+        {
+            return Id;
+        }
+    }
+    return InvalidIndex;
+}
+
+SIZE_T FJsonTreeNodeStore::FNameTable::GetAllocatedSize() const
+{
+    return Text.GetAllocatedSize() + Offsets.GetAllocatedSize() + FirstWithHash.GetAllocatedSize() + NextWithHash.GetAllocatedSize();
+}
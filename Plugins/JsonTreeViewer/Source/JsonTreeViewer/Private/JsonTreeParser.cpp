@@ -0,0 +1,832 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "JsonTreeParser.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+    // Bytes parsed between progress callbacks
+    constexpr int64 ProgressInterval = 1 << 20;
+
+    // Bytes parsed between clock reads in a stepped parse, which is about how far a step can overrun
+    // its time: tens of microseconds
+    constexpr int64 DeadlineCheckInterval = 16 * 1024;
+
+    bool IsDigit(uint8 C)
+    {
+        return C >= '0' && C <= '9';
+    }
+
+    int32 HexDigitValue(uint8 C)
+    {
+        if (C >= '0' && C <= '9') return C - '0';
+        if (C >= 'a' && C <= 'f') return C - 'a' + 10;
+        if (C >= 'A' && C <= 'F') return C - 'A' + 10;
+        return -1;
+    }
+
+    // Encode a code point as UTF-8, returning the number of bytes written
+    int32 EncodeUtf8(uint32 CodePoint, uint8* Out)
+    {
+        if (CodePoint < 0x80)
+        {
+            Out[0] = uint8(CodePoint);
+            return 1;
+        }
+        if (CodePoint < 0x800)
+        {
+            Out[0] = uint8(0xC0 | (CodePoint >> 6));
+            Out[1] = uint8(0x80 | (CodePoint & 0x3F));
+            return 2;
+        }
+        if (CodePoint < 0x10000)
+        {
+            Out[0] = uint8(0xE0 | (CodePoint >> 12));
+            Out[1] = uint8(0x80 | ((CodePoint >> 6) & 0x3F));
+            Out[2] = uint8(0x80 | (CodePoint & 0x3F));
+            return 3;
+        }
+        Out[0] = uint8(0xF0 | (CodePoint >> 18));
+        Out[1] = uint8(0x80 | ((CodePoint >> 12) & 0x3F));
+        Out[2] = uint8(0x80 | ((CodePoint >> 6) & 0x3F));
+        Out[3] = uint8(0x80 | (CodePoint & 0x3F));
+        return 4;
+    }
+
+    // Decode the escape sequence whose backslash is at Cursor - 1 into UTF-8, leaving Cursor on its
+    // last character. Returns the number of bytes written, or 0 with Cursor unchanged if the escape
+    // isn't valid. A \u high surrogate followed by a low one makes one code point.
+    int32 DecodeEscape(const uint8* Data, int64 Size, int64& Cursor, uint8* Decoded)
+    {
+        switch (Data[Cursor])
+        {
+        case '"':  Decoded[0] = '"'; return 1;
+        case '\\': Decoded[0] = '\\'; return 1;
+        case '/':  Decoded[0] = '/'; return 1;
+        case 'b':  Decoded[0] = '\b'; return 1;
+        case 'f':  Decoded[0] = '\f'; return 1;
+        case 'n':  Decoded[0] = '\n'; return 1;
+        case 'r':  Decoded[0] = '\r'; return 1;
+        case 't':  Decoded[0] = '\t'; return 1;
+        case 'u':
+            break;
+        default:
+            return 0;
+        }
+
+        // Read one \uXXXX unit, plus its low surrogate if it starts a pair
+        auto ReadUnit = [Data, Size](int64 At, uint32& OutUnit)
+        {
+            if (At + 4 > Size)
+            {
+                return false;
+            }
+            OutUnit = 0;
+            for (int64 Index = At; Index < At + 4; ++Index)
+            {
+                const int32 Digit = HexDigitValue(Data[Index]);
+                if (Digit < 0)
+                {
+                    return false;
+                }
+                OutUnit = (OutUnit << 4) | uint32(Digit);
+            }
+            return true;
+        };
+
+        uint32 CodePoint = 0;
+        if (!ReadUnit(Cursor + 1, CodePoint))
+        {
+            return 0;
+        }
+        Cursor += 4;
+
+        uint32 LowSurrogate = 0;
+        if (CodePoint >= 0xD800 && CodePoint < 0xDC00
+            && Cursor + 2 < Size && Data[Cursor + 1] == '\\' && Data[Cursor + 2] == 'u'
+            && ReadUnit(Cursor + 3, LowSurrogate) && LowSurrogate >= 0xDC00 && LowSurrogate < 0xE000)
+        {
+            CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+            Cursor += 6;
+        }
+        return EncodeUtf8(CodePoint, Decoded);
+    }
+}
+
+FJsonTreeParser::FJsonTreeParser(FJsonTreeNodeStore& InStore, const uint8* InData, int64 InSize)
+    : Store(InStore)
+    , Data(InData)
+    , Size(InSize)
+    , Pos(0)
+    , MaxDepth(MAX_int32)
+    , Deadline(0.0)
+    , Resume(EExpect::Value)
+    , bSuspended(false)
+    , bInputComplete(true)
+    , ErrorLine(0)
+    , ErrorColumn(0)
+{
+}
+
+bool FJsonTreeParser::ParseDocument(int32 InMaxDepth, TFunctionRef<bool(float)> OnProgress)
+{
+    Stack.Reset();
+    Pos = 0;
+    MaxDepth = InMaxDepth;
+    return Run(EExpect::Value, -1, OnProgress);
+}
+
+void FJsonTreeParser::BeginDocument(int32 InMaxDepth)
+{
+    Stack.Reset();
+    Pos = 0;
+    MaxDepth = InMaxDepth;
+    Resume = EExpect::Value;
+}
+
+EJsonTreeBuildStep FJsonTreeParser::ContinueDocument(double MaxSeconds)
+{
+    Deadline = FPlatformTime::Seconds() + MaxSeconds;
+    bSuspended = false;
+    const bool bDone = Run(Resume, -1, [](float) { return true; });
+    Deadline = 0.0;
+
+    if (bDone)
+    {
+        return EJsonTreeBuildStep::Done;
+    }
+    return bSuspended ? EJsonTreeBuildStep::Pending : EJsonTreeBuildStep::Failed;
+}
+
+void FJsonTreeParser::SetInput(const uint8* InData, int64 InSize, bool bInComplete)
+{
+    Data = InData;
+    Size = InSize;
+    bInputComplete = bInComplete;
+}
+
+bool FJsonTreeParser::ParseChildren(uint32 NodeIndex)
+{
+    const FJsonTreeNode& Node = Store.GetNode(NodeIndex);
+    const bool bObject = Node.GetType() == EJson::Object;
+
+    // The text was validated when the document was loaded, so this only rebuilds one level
+    Stack.Reset();
+    Pos = Node.Container.Source + 1;
+    MaxDepth = 1;
+
+    FFrame& Frame = Stack.AddDefaulted_GetRef();
+    Frame.Node = NodeIndex;
+    Frame.bObject = bObject;
+
+    return Run(bObject ? EExpect::KeyOrEnd : EExpect::ValueOrEnd, 0, [](float) { return true; });
+}
+
+bool FJsonTreeParser::ParseRecord(uint32 ParentIndex, uint32& LastChild)
+{
+    Stack.Reset();
+    Pos = 0;
+    MaxDepth = MAX_int32;
+
+    // The parent acts as an open array that receives exactly one element
+    FFrame& Frame = Stack.AddDefaulted_GetRef();
+    Frame.Node = ParentIndex;
+    Frame.LastChild = LastChild;
+
+    if (!Run(EExpect::Value, 1, [](float) { return true; }))
+    {
+        return false;
+    }
+
+    while (Pos < Size && (Data[Pos] == ' ' || Data[Pos] == '\n' || Data[Pos] == '\r' || Data[Pos] == '\t'))
+    {
+        ++Pos;
+    }
+    if (Pos < Size)
+    {
+        return Fail(Pos, TEXT("Unexpected character after the end of the record"));
+    }
+
+    LastChild = Stack[0].LastChild;
+    return true;
+}
+
+bool FJsonTreeParser::ParseSlice(uint32 ParentIndex, bool bObject, int64 Begin, uint32& LastChild, TFunctionRef<bool(float)> OnProgress)
+{
+    Stack.Reset();
+    Pos = Begin;
+    MaxDepth = MAX_int32;
+
+    // The parent stands in for the root, so its values are top-level items like in a whole document
+    FFrame& Frame = Stack.AddDefaulted_GetRef();
+    Frame.Node = ParentIndex;
+    Frame.LastChild = LastChild;
+    Frame.bObject = bObject;
+
+    while (true)
+    {
+        if (!Run(bObject ? EExpect::Key : EExpect::Value, 1, OnProgress))
+        {
+            return false;
+        }
+
+        while (Pos < Size && (Data[Pos] == ' ' || Data[Pos] == '\n' || Data[Pos] == '\r' || Data[Pos] == '\t'))
+        {
+            ++Pos;
+        }
+        if (Pos >= Size)
+        {
+            break;
+        }
+        if (Data[Pos] != ',')
+        {
+            return Fail(Pos, bObject ? TEXT("Expected ',' or '}'") : TEXT("Expected ',' or ']'"));
+        }
+        ++Pos;
+    }
+
+    LastChild = Stack[0].LastChild;
+    return true;
+}
+
+bool FJsonTreeParser::Run(EExpect Expect, int32 StopDepth, TFunctionRef<bool(float)> OnProgress)
+{
+    int64 NextProgress = Pos + ProgressInterval;
+    int64 NextDeadlineCheck = Pos + DeadlineCheckInterval;
+
+    while (true)
+    {
+        while (Pos < Size && (Data[Pos] == ' ' || Data[Pos] == '\n' || Data[Pos] == '\r' || Data[Pos] == '\t'))
+        {
+            ++Pos;
+        }
+        if (Pos >= Size)
+        {
+            // The input received so far ends between tokens, so the run picks up here once there is more
+            if (!bInputComplete)
+            {
+                Resume = Expect;
+                bSuspended = true;
+                return false;
+            }
+            return Expect == EExpect::End ? true : Fail(Pos, TEXT("Unexpected end of input"));
+        }
+        if (Pos >= NextProgress)
+        {
+            if (!OnProgress(float(double(Pos) / double(Size))))
+            {
+                return false;
+            }
+            NextProgress = Pos + ProgressInterval;
+        }
+        if (Deadline > 0.0 && Pos >= NextDeadlineCheck)
+        {
+            // Between tokens the stack and Expect are all the state there is, so the run can pick up here later
+            if (FPlatformTime::Seconds() >= Deadline)
+            {
+                Resume = Expect;
+                bSuspended = true;
+                return false;
+            }
+            NextDeadlineCheck = Pos + DeadlineCheckInterval;
+        }
+
+        const uint8 C = Data[Pos];
+        switch (Expect)
+        {
+        case EExpect::End:
+            return Fail(Pos, TEXT("Unexpected character after the end of the document"));
+
+        case EExpect::KeyOrEnd:
+            if (C == '}')
+            {
+                CloseContainer();
+                break;
+            }
+            // Otherwise this is the first member name
+            [[fallthrough]];
+        case EExpect::Key:
+        {
+            if (C != '"')
+            {
+                return Fail(Pos, TEXT("Expected a member name"));
+            }
+            // The name is unescaped at the end of the pool, interned, then dropped from the pool again
+            FFrame& Frame = Stack.Top();
+            const bool bBuild = Frame.Node != FJsonTreeNodeStore::InvalidIndex;
+            const int64 PoolStart = Store.Strings.Num();
+            uint32 KeyOffset = 0;
+            uint32 KeyLength = 0;
+            if (!ParseString(bBuild, KeyOffset, KeyLength))
+            {
+                return false;
+            }
+            if (bBuild)
+            {
+                if (Store.Names.NumBytes() + KeyLength > FJsonTreeNodeStore::MaxStringBytes)
+                {
+                    return Fail(Pos, TEXT("Member names need more than 4 GB"));
+                }
+                Frame.Key = Store.Names.Add(FUtf8StringView(Store.Strings.GetData() + KeyOffset, KeyLength));
+                Store.Strings.SetNum(PoolStart, EAllowShrinking::No);
+            }
+            Expect = EExpect::Colon;
+            continue;
+        }
+
+        case EExpect::Colon:
+            if (C != ':')
+            {
+                return Fail(Pos, TEXT("Expected ':' after the member name"));
+            }
+            ++Pos;
+            Expect = EExpect::Value;
+            continue;
+
+        case EExpect::ValueOrEnd:
+            if (C == ']')
+            {
+                CloseContainer();
+                break;
+            }
+            // Otherwise this is the first element
+            [[fallthrough]];
+        case EExpect::Value:
+            if (C == '{' || C == '[')
+            {
+                OpenContainer(C == '{');
+                Expect = C == '{' ? EExpect::KeyOrEnd : EExpect::ValueOrEnd;
+                continue;
+            }
+            if (!ParsePrimitive())
+            {
+                return false;
+            }
+            break;
+
+        case EExpect::CommaOrEnd:
+        {
+            const bool bObject = Stack.Top().bObject;
+            if (C == ',')
+            {
+                ++Pos;
+                Expect = bObject ? EExpect::Key : EExpect::Value;
+                continue;
+            }
+            if (C != (bObject ? '}' : ']'))
+            {
+                return Fail(Pos, bObject ? TEXT("Expected ',' or '}'") : TEXT("Expected ',' or ']'"));
+            }
+            CloseContainer();
+            break;
+        }
+        }
+
+        // A value, primitive or container, has just been completed
+        if (Stack.Num() == StopDepth)
+        {
+            return true;
+        }
+        Expect = Stack.Num() > 0 ? EExpect::CommaOrEnd : EExpect::End;
+    }
+}
+
+void FJsonTreeParser::OpenContainer(bool bObject)
+{
+    const EJson Type = bObject ? EJson::Object : EJson::Array;
+
+    FFrame Frame;
+    Frame.bObject = bObject;
+
+    if (Stack.Num() == 0)
+    {
+        Frame.Node = Store.AddNode(Type, FJsonTreeNodeStore::InvalidIndex, 0);
+        Store.GetNode(Frame.Node).Container.Source = uint32(Pos);
+    }
+    else
+    {
+        FFrame& Parent = Stack.Top();
+        Parent.bHasElements = true;
+
+        if (Parent.Node == FJsonTreeNodeStore::InvalidIndex)
+        {
+            // Inside a deferred container; only validate
+        }
+        else
+        {
+            const int32 ParentDepth = Parent.Depth;
+            const uint32 Index = AddChildNode(Parent, Type);
+            Store.GetNode(Index).Container.Source = uint32(Pos);
+
+            const int32 Depth = ParentDepth + 1;
+            if (Depth < MaxDepth)
+            {
+                Frame.Node = Index;
+                Frame.Depth = Depth;
+            }
+            else
+            {
+                // The container's offset is all that's needed to parse its children on demand
+                Store.GetNode(Index).Flags |= EJsonTreeNodeFlags::PendingChildren;
+                Frame.Deferred = Index;
+            }
+        }
+    }
+
+    Stack.Add(Frame);
+    ++Pos;
+}
+
+void FJsonTreeParser::CloseContainer()
+{
+    const FFrame Frame = Stack.Pop();
+    ++Pos;
+
+    if (!Frame.bObject && Frame.Node != FJsonTreeNodeStore::InvalidIndex)
+    {
+        // The element count is only known once the array is complete
+        Store.PageElements(Frame.Node);
+    }
+    else if (Frame.Deferred != FJsonTreeNodeStore::InvalidIndex && !Frame.bHasElements)
+    {
+        // Nothing to build later for an empty container
+        Store.GetNode(Frame.Deferred).Flags &= ~EJsonTreeNodeFlags::PendingChildren;
+    }
+}
+
+bool FJsonTreeParser::ParsePrimitive()
+{
+    FFrame* Parent = Stack.Num() > 0 ? &Stack.Top() : nullptr;
+    const bool bBuild = !Parent || Parent->Node != FJsonTreeNodeStore::InvalidIndex;
+    if (Parent)
+    {
+        Parent->bHasElements = true;
+    }
+
+    EJson Type = EJson::None;
+    uint32 Offset = 0;
+    uint32 Length = 0;
+    int64 Integer = 0;
+    double Number = 0.0;
+    bool bInteger = false;
+
+    switch (Data[Pos])
+    {
+    case '"':
+        Type = EJson::String;
+        if (!ParseString(bBuild, Offset, Length))
+        {
+            return false;
+        }
+        break;
+
+    case 't':
+        Type = EJson::Boolean;
+        Offset = FJsonTreeNodeStore::TrueOffset;
+        Length = 4;
+        if (!ParseLiteral("true", 4))
+        {
+            return false;
+        }
+        break;
+
+    case 'f':
+        Type = EJson::Boolean;
+        Offset = FJsonTreeNodeStore::FalseOffset;
+        Length = 5;
+        if (!ParseLiteral("false", 5))
+        {
+            return false;
+        }
+        break;
+
+    case 'n':
+        Type = EJson::Null;
+        Offset = FJsonTreeNodeStore::NullOffset;
+        Length = 4;
+        if (!ParseLiteral("null", 4))
+        {
+            return false;
+        }
+        break;
+
+    default:
+        if (Data[Pos] != '-' && !IsDigit(Data[Pos]))
+        {
+            return Fail(Pos, TEXT("Unexpected character"));
+        }
+        Type = EJson::Number;
+        if (!ParseNumber(bBuild, Integer, Number, bInteger))
+        {
+            return false;
+        }
+        break;
+    }
+
+    if (bBuild)
+    {
+        const uint32 Index = Parent ? AddChildNode(*Parent, Type) : Store.AddNode(Type, FJsonTreeNodeStore::InvalidIndex, 0);
+        FJsonTreeNode& Node = Store.GetNode(Index);
+        if (Type != EJson::Number)
+        {
+            Node.Value.Offset = Offset;
+            Node.Value.Length = Length;
+        }
+        else if (bInteger)
+        {
+            Node.Integer = Integer;
+            Node.Flags |= EJsonTreeNodeFlags::Integer;
+        }
+        else
+        {
+            Node.Number = Number;
+        }
+    }
+    return true;
+}
+
+uint32 FJsonTreeParser::AddChildNode(FFrame& Parent, EJson Type)
+{
+    uint32 Key = Parent.Key;
+    EJsonTreeNodeFlags Flags = EJsonTreeNodeFlags::None;
+    if (!Parent.bObject)
+    {
+        Key = Store.GetNode(Parent.Node).NumChildren;
+        Flags = EJsonTreeNodeFlags::Element;
+    }
+    else
+    {
+        const FUtf8StringView Name = Store.Names.Get(Key);
+        if (!Name.IsEmpty() && Name[0] == UTF8CHAR('@'))
+        {
+            Flags = EJsonTreeNodeFlags::AtKey;
+        }
+    }
+
+    const uint32 Index = Store.AddNode(Type, Parent.Node, Key);
+    Store.GetNode(Index).Flags = Flags;
+    Store.LinkChild(Parent.Node, Index, Parent.LastChild);
+    Parent.Key = 0;
+    return Index;
+}
+
+bool FJsonTreeParser::ParseString(bool bStore, uint32& OutOffset, uint32& OutLength)
+{
+    const int64 Quote = Pos;
+    const int64 PoolStart = Store.Strings.Num();
+    int64 RunStart = Pos + 1;
+    int64 Cursor = RunStart;
+
+    while (true)
+    {
+        if (Cursor >= Size)
+        {
+            return Fail(Quote, TEXT("Unterminated string"));
+        }
+
+        const uint8 C = Data[Cursor];
+        if (C == '"')
+        {
+            break;
+        }
+        if (C < 0x20)
+        {
+            return Fail(Cursor, TEXT("Control character in string"));
+        }
+        if (C != '\\')
+        {
+            ++Cursor;
+            continue;
+        }
+
+        // Copy the plain run before the escape, then the unescaped character
+        if (bStore)
+        {
+            AppendToPool(Data + RunStart, Cursor - RunStart);
+        }
+        if (++Cursor >= Size)
+        {
+            return Fail(Quote, TEXT("Unterminated string"));
+        }
+
+        uint8 Decoded[4];
+        const int32 DecodedLength = DecodeEscape(Data, Size, Cursor, Decoded);
+        if (DecodedLength == 0)
+        {
+            return Fail(Cursor - 1, Data[Cursor] == 'u' ? TEXT("Invalid \\u escape") : TEXT("Invalid escape sequence"));
+        }
+
+        if (bStore)
+        {
+            AppendToPool(Decoded, DecodedLength);
+        }
+        RunStart = ++Cursor;
+    }
+
+    Pos = Cursor + 1;
+    if (!bStore)
+    {
+        return true;
+    }
+
+    AppendToPool(Data + RunStart, Cursor - RunStart);
+    if (Store.Strings.Num() >= FJsonTreeNodeStore::MaxStringBytes)
+    {
+        return Fail(Quote, TEXT("Strings need more than 4 GB"));
+    }
+    OutLength = uint32(Store.Strings.Num() - PoolStart);
+    if (OutLength == 0)
+    {
+        OutOffset = 0;
+        return true;
+    }
+    OutOffset = uint32(PoolStart);
+    Store.Strings.Add(UTF8CHAR('\0'));
+    return true;
+}
+
+bool FJsonTreeParser::UnescapeString(const uint8* Text, int64 Length, TArray<UTF8CHAR>& Out)
+{
+    int64 RunStart = 0;
+    for (int64 Cursor = 0; Cursor < Length; ++Cursor)
+    {
+        if (Text[Cursor] != '\\')
+        {
+            continue;
+        }
+        Out.Append(reinterpret_cast<const UTF8CHAR*>(Text + RunStart), int32(Cursor - RunStart));
+        if (++Cursor >= Length)
+        {
+            return false;
+        }
+
+        uint8 Decoded[4];
+        const int32 DecodedLength = DecodeEscape(Text, Length, Cursor, Decoded);
+        if (DecodedLength == 0)
+        {
+            return false;
+        }
+        Out.Append(reinterpret_cast<const UTF8CHAR*>(Decoded), DecodedLength);
+        RunStart = Cursor + 1;
+    }
+    Out.Append(reinterpret_cast<const UTF8CHAR*>(Text + RunStart), int32(Length - RunStart));
+    return true;
+}
+
+bool FJsonTreeParser::ParseNumber(bool bStore, int64& OutInteger, double& OutNumber, bool& bOutInteger)
+{
+    const int64 Start = Pos;
+    const bool bNegative = Data[Pos] == '-';
+
+    // Magnitude of the integer part, accumulated while it is scanned
+    uint64 Magnitude = 0;
+    bool bOverflow = false;
+
+    if (bNegative)
+    {
+        ++Pos;
+    }
+    if (Pos < Size && Data[Pos] == '0')
+    {
+        ++Pos;
+    }
+    else if (Pos < Size && IsDigit(Data[Pos]))
+    {
+        while (Pos < Size && IsDigit(Data[Pos]))
+        {
+            const uint64 Digit = uint64(Data[Pos] - '0');
+            bOverflow |= Magnitude > (MAX_uint64 - Digit) / 10;
+            Magnitude = Magnitude * 10 + Digit;
+            ++Pos;
+        }
+    }
+    else
+    {
+        return Fail(Start, TEXT("Invalid number"));
+    }
+
+    bool bIntegral = true;
+    if (Pos < Size && Data[Pos] == '.')
+    {
+        bIntegral = false;
+        if (++Pos >= Size || !IsDigit(Data[Pos]))
+        {
+            return Fail(Start, TEXT("Invalid number"));
+        }
+        while (Pos < Size && IsDigit(Data[Pos]))
+        {
+            ++Pos;
+        }
+    }
+
+    if (Pos < Size && (Data[Pos] == 'e' || Data[Pos] == 'E'))
+    {
+        bIntegral = false;
+        ++Pos;
+        if (Pos < Size && (Data[Pos] == '+' || Data[Pos] == '-'))
+        {
+            ++Pos;
+        }
+        if (Pos >= Size || !IsDigit(Data[Pos]))
+        {
+            return Fail(Start, TEXT("Invalid number"));
+        }
+        while (Pos < Size && IsDigit(Data[Pos]))
+        {
+            ++Pos;
+        }
+    }
+
+    if (!bStore)
+    {
+        return true;
+    }
+
+    // Integers are kept exactly as long as int64 holds them. -0 has no integer form and stays a
+    // double, as does everything with a fraction or exponent.
+    const uint64 Limit = bNegative ? uint64(MAX_int64) + 1 : uint64(MAX_int64);
+    if (bIntegral && !bOverflow && Magnitude <= Limit && (Magnitude != 0 || !bNegative))
+    {
+        OutInteger = bNegative ? int64(0 - Magnitude) : int64(Magnitude);
+        bOutInteger = true;
+        return true;
+    }
+
+    TArray<ANSICHAR, TInlineAllocator<64>> Token;
+    Token.Append(reinterpret_cast<const ANSICHAR*>(Data + Start), int32(Pos - Start));
+    Token.Add('\0');
+    OutNumber = FCStringAnsi::Atod(Token.GetData());
+    bOutInteger = false;
+    return true;
+}
+
+bool FJsonTreeParser::ParseLiteral(const ANSICHAR* Literal, int32 Length)
+{
+    if (Pos + Length > Size || FMemory::Memcmp(Data + Pos, Literal, Length) != 0)
+    {
+        return Fail(Pos, TEXT("Unexpected character"));
+    }
+    Pos += Length;
+    return true;
+}
+
+void FJsonTreeParser::AppendToPool(const uint8* Bytes, int64 Count)
+{
+    Store.Strings.Append(reinterpret_cast<const UTF8CHAR*>(Bytes), Count);
+}
+
+bool FJsonTreeParser::Fail(int64 Offset, const TCHAR* Message)
+{
+    Offset = FMath::Min(Offset, Size);
+
+    // Positions are only needed on failure, so they're worked out from the offset here
+    // rather than tracked while parsing
+    ErrorLine = 1;
+    int64 LineStart = 0;
+    for (int64 Index = 0; Index < Offset; ++Index)
+    {
+        if (Data[Index] == '\n')
+        {
+            ++ErrorLine;
+            LineStart = Index + 1;
+        }
+    }
+
+    // Columns count characters, so UTF-8 continuation bytes are skipped
+    ErrorColumn = 1;
+    for (int64 Index = LineStart; Index < Offset; ++Index)
+    {
+        if ((Data[Index] & 0xC0) != 0x80)
+        {
+            ++ErrorColumn;
+        }
+    }
+
+    Error = Message;
+    return false;
+}
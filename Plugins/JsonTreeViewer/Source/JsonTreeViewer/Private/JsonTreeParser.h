@@ -0,0 +1,168 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JsonTreeNodeStore.h"
+
+/**
+ * FJsonTreeParser
+ *
+ * Iterative JSON parser that reads UTF-8 bytes in place and writes nodes straight into an
+ * FJsonTreeNodeStore, without building an FJsonValue document first. Containers below the
+ * requested depth are still validated, but are only recorded as a source offset so their
+ * children can be parsed later by ParseChildren.
+ */
+class FJsonTreeParser
+{
+public:
+    FJsonTreeParser(FJsonTreeNodeStore& InStore, const uint8* InData, int64 InSize);
+
+    // Parse a whole document into an empty store. Containers at MaxDepth keep their children
+    // pending. OnProgress receives the fraction of bytes read and returns false to abort.
+    // Returns false on a syntax error (see GetError) or when aborted.
+    bool ParseDocument(int32 MaxDepth, TFunctionRef<bool(float)> OnProgress);
+
+    // Parse a whole document in steps instead: BeginDocument sets up the parse into an empty store and
+    // every ContinueDocument call parses for about MaxSeconds before returning Pending, or Done or
+    // Failed once the document is complete or has a syntax error. Between steps the store holds every
+    // node parsed so far, linked to its parent.
+    void BeginDocument(int32 MaxDepth);
+    EJsonTreeBuildStep ContinueDocument(double MaxSeconds);
+
+    // Point a stepped parse at input that has grown, or moved. Until bInComplete the input must end
+    // between tokens, and ContinueDocument returns Pending once it has parsed all of it.
+    void SetInput(const uint8* InData, int64 InSize, bool bInComplete);
+
+    // Objects and arrays open at the cursor, including the root
+    int32 GetOpenDepth() const { return Stack.Num(); }
+
+    // Fraction of the input read so far
+    float GetProgress() const { return Size > 0 ? float(double(Pos) / double(Size)) : 1.f; }
+
+    // Parse the children of a pending container from its source text, one level deep
+    bool ParseChildren(uint32 NodeIndex);
+
+    // Parse the text as a single value, e.g. one NDJSON record, and append it to ParentIndex's
+    // children after LastChild, which is updated. Nothing but whitespace may follow the value.
+    bool ParseRecord(uint32 ParentIndex, uint32& LastChild);
+
+    // Parse a run of comma-separated members or elements of the root container, starting at Begin
+    // and ending with the input, and append them to ParentIndex's children after LastChild, which is
+    // updated. Used to build slices of one document on several threads; offsets and error positions
+    // are relative to the start of the whole document.
+    bool ParseSlice(uint32 ParentIndex, bool bObject, int64 Begin, uint32& LastChild, TFunctionRef<bool(float)> OnProgress);
+
+    // Append the unescaped UTF-8 text of a string's contents, the bytes between its quotes, to Out.
+    // Returns false on an invalid escape.
+    static bool UnescapeString(const uint8* Text, int64 Length, TArray<UTF8CHAR>& Out);
+
+    // Description and 1-based position of the syntax error that stopped the parser
+    const FString& GetError() const { return Error; }
+    int32 GetErrorLine() const { return ErrorLine; }
+    int32 GetErrorColumn() const { return ErrorColumn; }
+
+private:
+    // What the parser accepts next
+    enum class EExpect : uint8
+    {
+        Value,
+        ValueOrEnd,     // First element of an array, or ']'
+        KeyOrEnd,       // First member of an object, or '}'
+        Key,
+        Colon,
+        CommaOrEnd,
+        End,            // Only whitespace may follow the document
+    };
+
+    // An object or array that is open while parsing
+    struct FFrame
+    {
+        uint32 Node = FJsonTreeNodeStore::InvalidIndex;        // Node receiving children; InvalidIndex while only validating
+        uint32 LastChild = FJsonTreeNodeStore::InvalidIndex;   // Last child linked to Node
+        uint32 Deferred = FJsonTreeNodeStore::InvalidIndex;    // Node whose children were deferred to this container
+        uint32 Key = 0;                                         // Name id of the member being parsed
+        int32 Depth = 0;                                        // Tree depth of Node
+        bool bObject = false;
+        bool bHasElements = false;
+    };
+
+    // Run the state machine until a value completes with StopDepth frames left open. A negative
+    // StopDepth parses through to the end of the input. Once Deadline has passed the run stops
+    // between tokens with bSuspended set, and Resume holds what it expected next.
+    bool Run(EExpect Expect, int32 StopDepth, TFunctionRef<bool(float)> OnProgress);
+
+    // Add a node for the value being parsed and link it to the parent's children. Members take the
+    // parsed name; array elements are keyed by their index.
+    uint32 AddChildNode(FFrame& Parent, EJson Type);
+
+    // Push a frame for the '{' or '[' at the cursor, adding its node if the parent is being built
+    void OpenContainer(bool bObject);
+
+    // Pop the frame of the '}' or ']' at the cursor
+    void CloseContainer();
+
+    // Parse a string, number, boolean or null at the cursor
+    bool ParsePrimitive();
+
+    // Parse the string at the cursor; when bStore, its unescaped UTF-8 text is added to the pool
+    bool ParseString(bool bStore, uint32& OutOffset, uint32& OutLength);
+
+    // Parse the number at the cursor; when bStore, its value is written to OutInteger if it is integral
+    // and fits, with bOutInteger set, or to OutNumber otherwise
+    bool ParseNumber(bool bStore, int64& OutInteger, double& OutNumber, bool& bOutInteger);
+
+    // Consume a literal such as "true" at the cursor
+    bool ParseLiteral(const ANSICHAR* Literal, int32 Length);
+
+    // Append UTF-8 bytes to the store's string pool
+    void AppendToPool(const uint8* Bytes, int64 Count);
+
+    // Record a syntax error at a byte offset, returning false for convenience
+    bool Fail(int64 Offset, const TCHAR* Message);
+
+    FJsonTreeNodeStore& Store;
+    const uint8* Data;
+    int64 Size;
+    int64 Pos;
+    int32 MaxDepth;
+
+    // Time at which a stepped parse returns, or 0 to parse without stopping
+    double Deadline;
+    EExpect Resume;
+    bool bSuspended;
+
+    // Whether the input is the whole document rather than the part of a stream received so far
+    bool bInputComplete;
+
+    TArray<FFrame, TInlineAllocator<64>> Stack;
+
+    FString Error;
+    int32 ErrorLine;
+    int32 ErrorColumn;
+};
@@ -0,0 +1,370 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "JsonTreeScanner.h"
+#include "JsonTreeViewerStats.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#elif PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#include <arm_neon.h>
+#endif
+
+namespace
+{
+    // Bytes classified at a time, one bit each in a 64-bit mask
+    constexpr int64 BlockBytes = 64;
+
+    // Characters of interest in one block, one bit per byte
+    struct FBlockMasks
+    {
+        uint64 Quote = 0;
+        uint64 Backslash = 0;
+        uint64 Open = 0;        // '{' and '['
+        uint64 Close = 0;       // '}' and ']'
+        uint64 Comma = 0;
+        uint64 Whitespace = 0;  // Any byte up to ' ', which outside strings can only be valid whitespace
+    };
+
+#if PLATFORM_CPU_X86_FAMILY
+    void ClassifyBlock(const uint8* Block, FBlockMasks& Out)
+    {
+        const __m128i QuoteChar = _mm_set1_epi8('"');
+        const __m128i BackslashChar = _mm_set1_epi8('\\');
+        const __m128i OpenChar = _mm_set1_epi8('{');
+        const __m128i CloseChar = _mm_set1_epi8('}');
+        const __m128i CommaChar = _mm_set1_epi8(',');
+        const __m128i SpaceChar = _mm_set1_epi8(' ');
+
+        for (int32 Lane = 0; Lane < 4; ++Lane)
+        {
+            const __m128i Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Block + Lane * 16));
+
+            // '[' and ']' are '{' and '}' without the 0x20 bit, so one compare finds both kinds of bracket
+            const __m128i Folded = _mm_or_si128(Bytes, SpaceChar);
+            const int32 Shift = Lane * 16;
+
+            Out.Quote |= uint64(uint16(_mm_movemask_epi8(_mm_cmpeq_epi8(Bytes, QuoteChar)))) << Shift;
+            Out.Backslash |= uint64(uint16(_mm_movemask_epi8(_mm_cmpeq_epi8(Bytes, BackslashChar)))) << Shift;
+            Out.Open |= uint64(uint16(_mm_movemask_epi8(_mm_cmpeq_epi8(Folded, OpenChar)))) << Shift;
+            Out.Close |= uint64(uint16(_mm_movemask_epi8(_mm_cmpeq_epi8(Folded, CloseChar)))) << Shift;
+            Out.Comma |= uint64(uint16(_mm_movemask_epi8(_mm_cmpeq_epi8(Bytes, CommaChar)))) << Shift;
+            Out.Whitespace |= uint64(uint16(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(Bytes, SpaceChar), SpaceChar)))) << Shift;
+        }
+    }
+#elif PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+    // Gather the top bit of each byte of four compare results into one 64-bit mask
+    uint64 ToBitmask(uint8x16_t A, uint8x16_t B, uint8x16_t C, uint8x16_t D)
+    {
+        static const uint8x16_t BitWeights = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+        uint8x16_t Sum0 = vpaddq_u8(vandq_u8(A, BitWeights), vandq_u8(B, BitWeights));
+        const uint8x16_t Sum1 = vpaddq_u8(vandq_u8(C, BitWeights), vandq_u8(D, BitWeights));
+        Sum0 = vpaddq_u8(Sum0, Sum1);
+        Sum0 = vpaddq_u8(Sum0, Sum0);
+        return vgetq_lane_u64(vreinterpretq_u64_u8(Sum0), 0);
+    }
+
+    void ClassifyBlock(const uint8* Block, FBlockMasks& Out)
+    {
+        uint8x16_t Bytes[4];
+        uint8x16_t Folded[4];
+        for (int32 Lane = 0; Lane < 4; ++Lane)
+        {
+            Bytes[Lane] = vld1q_u8(Block + Lane * 16);
+
+            // '[' and ']' are '{' and '}' without the 0x20 bit, so one compare finds both kinds of bracket
+            Folded[Lane] = vorrq_u8(Bytes[Lane], vdupq_n_u8(0x20));
+        }
+
+        auto Equal = [](const uint8x16_t* Lanes, uint8 Char)
+        {
+            const uint8x16_t Splat = vdupq_n_u8(Char);
+            return ToBitmask(vceqq_u8(Lanes[0], Splat), vceqq_u8(Lanes[1], Splat), vceqq_u8(Lanes[2], Splat), vceqq_u8(Lanes[3], Splat));
+        };
+        const uint8x16_t Space = vdupq_n_u8(' ');
+
+        Out.Quote = Equal(Bytes, '"');
+        Out.Backslash = Equal(Bytes, '\\');
+        Out.Open = Equal(Folded, '{');
+        Out.Close = Equal(Folded, '}');
+        Out.Comma = Equal(Bytes, ',');
+        Out.Whitespace = ToBitmask(vcleq_u8(Bytes[0], Space), vcleq_u8(Bytes[1], Space), vcleq_u8(Bytes[2], Space), vcleq_u8(Bytes[3], Space));
+    }
+#else
+    void ClassifyBlock(const uint8* Block, FBlockMasks& Out)
+    {
+        for (int32 Index = 0; Index < BlockBytes; ++Index)
+        {
+            const uint64 Bit = uint64(1) << Index;
+            switch (Block[Index])
+            {
+            case '"':  Out.Quote |= Bit; break;
+            case '\\': Out.Backslash |= Bit; break;
+            case '{':
+            case '[':  Out.Open |= Bit; break;
+            case '}':
+            case ']':  Out.Close |= Bit; break;
+            case ',':  Out.Comma |= Bit; break;
+            default:
+                if (Block[Index] <= ' ')
+                {
+                    Out.Whitespace |= Bit;
+                }
+                break;
+            }
+        }
+    }
+#endif
+
+    // Bits of the characters that follow an odd run of backslashes, carrying a run across blocks
+    uint64 FindEscaped(uint64 Backslash, uint64& InOutPrevEscaped)
+    {
+        constexpr uint64 EvenBits = 0x5555555555555555ull;
+
+        // A backslash escaped by the previous block doesn't start a run
+        Backslash &= ~InOutPrevEscaped;
+        const uint64 FollowsEscape = (Backslash << 1) | InOutPrevEscaped;
+
+        // Adding the starts of runs that begin on odd bits carries each of them to the end of the run
+        const uint64 OddRunStarts = Backslash & ~EvenBits & ~FollowsEscape;
+        const uint64 RunsFromEvenBits = OddRunStarts + Backslash;
+        InOutPrevEscaped = RunsFromEvenBits < Backslash ? 1 : 0;
+
+        return (EvenBits ^ (RunsFromEvenBits << 1)) & FollowsEscape;
+    }
+
+    // Each bit XORed with all the bits below it, which turns quote positions into string interiors
+    uint64 PrefixXor(uint64 Bits)
+    {
+        Bits ^= Bits << 1;
+        Bits ^= Bits << 2;
+        Bits ^= Bits << 4;
+        Bits ^= Bits << 8;
+        Bits ^= Bits << 16;
+        Bits ^= Bits << 32;
+        return Bits;
+    }
+
+    // Running totals of the text scanned so far
+    struct FScanTotals
+    {
+        int64 Commas = 0;
+        int64 Opens = 0;
+        int64 Closes = 0;
+        int64 Quotes = 0;
+        int64 StringContent = 0;
+
+        FScanTotals operator-(const FScanTotals& Start) const
+        {
+            FScanTotals Result;
+            Result.Commas = Commas - Start.Commas;
+            Result.Opens = Opens - Start.Opens;
+            Result.Closes = Closes - Start.Closes;
+            Result.Quotes = Quotes - Start.Quotes;
+            Result.StringContent = StringContent - Start.StringContent;
+            return Result;
+        }
+
+        FJsonTreeScanCounts ToCounts() const
+        {
+            // Every value but the first in a container follows a comma, and each string gets a
+            // terminator. Numbers and literals take no pool space.
+            FJsonTreeScanCounts Counts;
+            Counts.MaxNodes = Commas + Opens + 1;
+            Counts.StringBytes = StringContent + Quotes / 2;
+            return Counts;
+        }
+    };
+
+    // Structural characters and counts of one classified block
+    struct FBlockTotals
+    {
+        uint64 Comma;
+        uint64 Open;
+        uint64 Quote;
+        uint64 StringContent;
+
+        // Totals of the lowest NumBits bits, added to the totals at the start of the block
+        FScanTotals Below(const FScanTotals& Start, uint32 NumBits) const
+        {
+            const uint64 Mask = NumBits >= 64 ? ~uint64(0) : (uint64(1) << NumBits) - 1;
+            FScanTotals Result = Start;
+            Result.Commas += FMath::CountBits(Comma & Mask);
+            Result.Opens += FMath::CountBits(Open & Mask);
+            Result.Quotes += FMath::CountBits(Quote & Mask);
+            Result.StringContent += FMath::CountBits(StringContent & Mask);
+            return Result;
+        }
+    };
+}
+
+bool FJsonTreeScanner::Scan(const uint8* Data, int64 Size, FJsonTreeScanCounts& OutCounts)
+{
+    return Run(Data, Size, 0, nullptr, nullptr, OutCounts);
+}
+
+bool FJsonTreeScanner::ScanSlices(const uint8* Data, int64 Size, int64 MinSliceBytes, int64& OutRootOpen, TArray<FJsonTreeTextSlice>& OutSlices, FJsonTreeScanCounts& OutCounts)
+{
+    return Run(Data, Size, MinSliceBytes, &OutRootOpen, &OutSlices, OutCounts);
+}
+
+bool FJsonTreeScanner::Run(const uint8* Data, int64 Size, int64 MinSliceBytes, int64* OutRootOpen, TArray<FJsonTreeTextSlice>* OutSlices, FJsonTreeScanCounts& OutCounts)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeScanner::Scan");
+    uint64 PrevEscaped = 0;
+    uint64 PrevInString = 0;
+
+    int64 Depth = 0;
+    int64 RootOpen = INDEX_NONE;
+    int64 RootClose = INDEX_NONE;
+    int64 FirstNonWhitespace = INDEX_NONE;
+    int64 LastNonWhitespace = INDEX_NONE;
+
+    FScanTotals Totals;
+    FScanTotals SliceStartTotals;
+    int64 SliceStart = 0;
+
+    auto AddSlice = [&](int64 End, const FScanTotals& EndTotals)
+    {
+        FJsonTreeTextSlice& Slice = OutSlices->AddDefaulted_GetRef();
+        Slice.Begin = SliceStart;
+        Slice.End = End;
+        Slice.Counts = (EndTotals - SliceStartTotals).ToCounts();
+        ++Slice.Counts.MaxNodes;    // The root that the slice's values are parsed under
+        SliceStart = End + 1;
+        SliceStartTotals = EndTotals;
+    };
+
+    // The last partial block is padded with spaces, which classify as nothing
+    alignas(16) uint8 Padded[BlockBytes];
+
+    for (int64 Base = 0; Base < Size; Base += BlockBytes)
+    {
+        const uint8* Block = Data + Base;
+        if (Size - Base < BlockBytes)
+        {
+            FMemory::Memset(Padded, ' ', BlockBytes);
+            FMemory::Memcpy(Padded, Block, Size - Base);
+            Block = Padded;
+        }
+
+        FBlockMasks Masks;
+        ClassifyBlock(Block, Masks);
+
+        // Interiors include the opening quote but not the closing one
+        const uint64 Quotes = Masks.Quote & ~FindEscaped(Masks.Backslash, PrevEscaped);
+        const uint64 InString = PrefixXor(Quotes) ^ PrevInString;
+        PrevInString = uint64(int64(InString) >> 63);
+        const uint64 Outside = ~(InString | Quotes);
+
+        FBlockTotals Found;
+        Found.Comma = Masks.Comma & Outside;
+        Found.Open = Masks.Open & Outside;
+        Found.Quote = Quotes;
+        Found.StringContent = InString & ~Quotes;
+        const uint64 Close = Masks.Close & Outside;
+
+        Totals.Closes += FMath::CountBits(Close);
+
+        const uint64 NonWhitespace = ~Masks.Whitespace | InString | Quotes;
+        if (OutSlices && NonWhitespace != 0)
+        {
+            if (FirstNonWhitespace == INDEX_NONE)
+            {
+                FirstNonWhitespace = Base + FMath::CountTrailingZeros64(NonWhitespace);
+            }
+            LastNonWhitespace = Base + 63 - FMath::CountLeadingZeros64(NonWhitespace);
+        }
+
+        // Only slicing needs the nesting at each comma; counting gets by with the totals
+        uint64 Walk = OutSlices ? Found.Open | Close | Found.Comma : 0;
+        while (Walk != 0)
+        {
+            const uint32 Bit = uint32(FMath::CountTrailingZeros64(Walk));
+            const uint64 BitMask = uint64(1) << Bit;
+            const int64 Pos = Base + Bit;
+            Walk &= Walk - 1;
+
+            if (Found.Open & BitMask)
+            {
+                if (Depth == 0)
+                {
+                    if (RootOpen != INDEX_NONE)
+                    {
+                        return false;
+                    }
+                    RootOpen = Pos;
+                    SliceStart = Pos + 1;
+                    SliceStartTotals = Found.Below(Totals, Bit + 1);
+                }
+                ++Depth;
+            }
+            else if (Close & BitMask)
+            {
+                if (--Depth < 0)
+                {
+                    return false;
+                }
+                if (Depth == 0)
+                {
+                    RootClose = Pos;
+                    if (OutSlices)
+                    {
+                        AddSlice(Pos, Found.Below(Totals, Bit));
+                    }
+                }
+            }
+            else if (Depth == 1 && Pos - SliceStart >= MinSliceBytes)
+            {
+                AddSlice(Pos, Found.Below(Totals, Bit + 1));
+            }
+        }
+
+        Totals.Commas += FMath::CountBits(Found.Comma);
+        Totals.Opens += FMath::CountBits(Found.Open);
+        Totals.Quotes += FMath::CountBits(Found.Quote);
+        Totals.StringContent += FMath::CountBits(Found.StringContent);
+    }
+
+    if (PrevInString != 0 || Totals.Opens != Totals.Closes)
+    {
+        return false;
+    }
+
+    // The root container has to be the whole document
+    if (OutSlices)
+    {
+        if (RootOpen == INDEX_NONE || RootOpen != FirstNonWhitespace || RootClose != LastNonWhitespace)
+        {
+            return false;
+        }
+        *OutRootOpen = RootOpen;
+    }
+
+    OutCounts = Totals.ToCounts();
+    return true;
+}
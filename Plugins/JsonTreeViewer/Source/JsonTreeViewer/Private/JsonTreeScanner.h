@@ -0,0 +1,74 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// What a structural scan found in a stretch of JSON text, used to size a node store before parsing it
+struct FJsonTreeScanCounts
+{
+    // Upper bound of the nodes the text turns into: one per value
+    int64 MaxNodes = 0;
+
+    // Estimate of the string pool bytes: string contents and terminators
+    int64 StringBytes = 0;
+};
+
+// Text of a run of the root container's values, ending at a top-level comma or the closing bracket
+struct FJsonTreeTextSlice
+{
+    int64 Begin = 0;
+    int64 End = 0;
+    FJsonTreeScanCounts Counts;
+};
+
+/**
+ * FJsonTreeScanner
+ *
+ * Structural pre-scan of UTF-8 JSON text in the manner of simdjson's first stage. Quotes,
+ * backslashes, brackets, commas and colons are classified 64 bytes at a time with SSE2 or NEON
+ * (a scalar loop elsewhere), escaped quotes are resolved with carry arithmetic and string
+ * interiors with a prefix XOR, so the text is covered in one pass without a per-byte state
+ * machine. The scan doesn't validate values, which the parser does while building; it only checks
+ * that strings close and brackets balance.
+ */
+class FJsonTreeScanner
+{
+public:
+    // Count what the whole document turns into. Returns false if a string is left open or there
+    // are more opening than closing brackets or the other way round.
+    static bool Scan(const uint8* Data, int64 Size, FJsonTreeScanCounts& OutCounts);
+
+    // Also cut the values of the root container into slices of at least MinSliceBytes, each with its
+    // own counts. Returns false as Scan does, if the brackets close out of order, or if the root is
+    // not an object or array with nothing but whitespace around it.
+    static bool ScanSlices(const uint8* Data, int64 Size, int64 MinSliceBytes, int64& OutRootOpen, TArray<FJsonTreeTextSlice>& OutSlices, FJsonTreeScanCounts& OutCounts);
+
+private:
+    static bool Run(const uint8* Data, int64 Size, int64 MinSliceBytes, int64* OutRootOpen, TArray<FJsonTreeTextSlice>* OutSlices, FJsonTreeScanCounts& OutCounts);
+};
@@ -0,0 +1,121 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include "JsonTreeSearch.h"
+#include "JsonTreeSearchIndex.h"
+#include "JsonTreeSource.h"
+#include "Async/Async.h"
+
+void FJsonTreeSearch::Reset()
+{
+    CancelSearch();
+    ++IndexSerial;
+    Index.Reset();
+    bIndexing = false;
+}
+
+void FJsonTreeSearch::BuildIndex(const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe>& Source, const TSharedRef<FThreadSafeBool, ESPMode::ThreadSafe>& bCancelled, TFunction<void()> OnIndexed)
+{
+    bIndexing = true;
+    TWeakPtr<FJsonTreeSearch> WeakThis = AsShared();
+
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Serial = IndexSerial, Source, bCancelled, OnIndexed = MoveTemp(OnIndexed)]() mutable
+    {
+        TSharedPtr<FJsonTreeSearchIndex, ESPMode::ThreadSafe> Built = FJsonTreeSearchIndex::Build(Source, *bCancelled);
+        if (!Built.IsValid())
+        {
+            return;
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, Built, OnIndexed = MoveTemp(OnIndexed)]()
+        {
+            const TSharedPtr<FJsonTreeSearch> Search = WeakThis.Pin();
+            if (Search.IsValid() && Search->IndexSerial == Serial && Search->bIndexing)
+            {
+                Search->bIndexing = false;
+                Search->Index = Built;
+                OnIndexed();
+            }
+        });
+    });
+}
+
+void FJsonTreeSearch::SetIndex(const TSharedPtr<FJsonTreeSearchIndex, ESPMode::ThreadSafe>& InIndex)
+{
+    Index = InIndex;
+    bIndexing = false;
+}
+
+void FJsonTreeSearch::SetQuery(const FString& InQuery)
+{
+    CancelSearch();
+    Query = InQuery;
+    Highlight = FText::FromString(InQuery);
+}
+
+void FJsonTreeSearch::Run(TFunction<void()> OnFound)
+{
+    SearchCancelled = MakeShared<FThreadSafeBool, ESPMode::ThreadSafe>(false);
+    TWeakPtr<FJsonTreeSearch> WeakThis = AsShared();
+
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Serial = SearchSerial, SearchIndex = Index, Cancelled = SearchCancelled, Text = Query, OnFound = MoveTemp(OnFound)]() mutable
+    {
+        // The index holds UTF-8 like the node store, so the query is converted once instead of every value
+        const FTCHARToUTF8 Utf8Query(*Text, Text.Len());
+        TArray<uint32> Found;
+        if (!SearchIndex->Find(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Utf8Query.Get()), Utf8Query.Length()), *Cancelled, Found))
+        {
+            return;
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, Found = MoveTemp(Found), OnFound = MoveTemp(OnFound)]() mutable
+        {
+            const TSharedPtr<FJsonTreeSearch> Search = WeakThis.Pin();
+            if (Search.IsValid() && Search->SearchSerial == Serial)
+            {
+                Search->Matches = MoveTemp(Found);
+                Search->ResultIndex = INDEX_NONE;
+                OnFound();
+            }
+        });
+    });
+}
+
+void FJsonTreeSearch::CancelSearch()
+{
+    if (SearchCancelled.IsValid())
+    {
+        SearchCancelled->AtomicSet(true);
+    }
+    ++SearchSerial;
+    Matches.Reset();
+    ResultIndex = INDEX_NONE;
+}
+
+SIZE_T FJsonTreeSearch::GetAllocatedSize(bool bCountIndex) const
+{
+    return (bCountIndex && Index.IsValid() ? Index->GetAllocatedSize() : 0) + Matches.GetAllocatedSize();
+}
@@ -0,0 +1,104 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeBool.h"
+
+class FJsonTreeSearchIndex;
+class FJsonTreeSource;
+
+/**
+ * FJsonTreeSearch
+ *
+ * A widget's search of the document it shows: the search index, the query, its matches and the
+ * one last scrolled to. Indexing and searching run on worker threads; their results are handed
+ * back on the game thread unless a newer query or document has replaced them meanwhile.
+ */
+class FJsonTreeSearch : public TSharedFromThis<FJsonTreeSearch>
+{
+public:
+    // Drop the index and the matches of the previous document, cancelling any indexing or search
+    // under way; the query stays, to be run against the next index
+    void Reset();
+
+    // Index a document on a worker thread. OnIndexed runs on the game thread once the index is
+    // set, unless Reset was called or bCancelled raised first
+    void BuildIndex(const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe>& Source, const TSharedRef<FThreadSafeBool, ESPMode::ThreadSafe>& bCancelled, TFunction<void()> OnIndexed);
+
+    // Use an index built before, e.g. for another widget showing the same document
+    void SetIndex(const TSharedPtr<FJsonTreeSearchIndex, ESPMode::ThreadSafe>& InIndex);
+    const TSharedPtr<FJsonTreeSearchIndex, ESPMode::ThreadSafe>& GetIndex() const { return Index; }
+
+    // Whether an index is on its way: being built, or waiting for the tree it indexes to be
+    bool IsIndexing() const { return bIndexing; }
+    void SetIndexPending(bool bPending) { bIndexing = bPending; }
+
+    // Search for a new query, cancelling the search for the previous one and dropping its matches
+    void SetQuery(const FString& InQuery);
+    const FString& GetQuery() const { return Query; }
+
+    // The query, for highlighting it in rows
+    const FText& GetHighlight() const { return Highlight; }
+
+    // Run the query against the index on a worker thread. OnFound runs on the game thread once the
+    // matches are set, unless the query changed or Reset was called first
+    void Run(TFunction<void()> OnFound);
+
+    // Nodes of the search index matching the query, in document order
+    const TArray<uint32>& GetMatches() const { return Matches; }
+
+    // Match last scrolled to, INDEX_NONE before the first
+    int32 GetResultIndex() const { return ResultIndex; }
+    void SetResultIndex(int32 InResultIndex) { ResultIndex = InResultIndex; }
+
+    // Bytes held by the matches, and by the index with bCountIndex, which is left out where it is
+    // shared with other widgets
+    SIZE_T GetAllocatedSize(bool bCountIndex) const;
+
+private:
+    // Abort the search that is running and discard its results
+    void CancelSearch();
+
+    TSharedPtr<FJsonTreeSearchIndex, ESPMode::ThreadSafe> Index;
+    bool bIndexing = false;
+
+    // Incremented by Reset; an index built for an older document is discarded
+    uint32 IndexSerial = 0;
+
+    FString Query;
+    FText Highlight;
+
+    // Incremented by every search; results of an older search are discarded
+    uint32 SearchSerial = 0;
+
+    // Raised to abort the search that is currently running
+    TSharedPtr<FThreadSafeBool, ESPMode::ThreadSafe> SearchCancelled;
+
+    TArray<uint32> Matches;
+    int32 ResultIndex = INDEX_NONE;
+};
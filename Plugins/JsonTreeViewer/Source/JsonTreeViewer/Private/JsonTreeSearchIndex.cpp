@@ -0,0 +1,675 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "JsonTreeSearchIndex.h"
+#include "JsonTreeParser.h"
+#include "JsonTreeSource.h"
+#include "JsonTreeViewerStats.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Reverse.h"
+#include "Algo/Unique.h"
+
+namespace
+{
+    // Values longer than this are checked by every query instead of being split into trigrams
+    constexpr int32 MaxTrigramValueBytes = 256;
+
+    // Strings checked, or tokens read, between looks at the cancellation flag
+    constexpr int32 CancelCheckInterval = 4096;
+
+    // Unescaped strings and number text are copied into blocks of at least this many bytes
+    constexpr int32 TextBlockBytes = 64 * 1024;
+
+    uint8 FoldCase(uint8 C)
+    {
+        return C >= 'A' && C <= 'Z' ? C + ('a' - 'A') : C;
+    }
+
+    uint32 MakeTrigram(const uint8* Bytes)
+    {
+        return (uint32(FoldCase(Bytes[0])) << 16) | (uint32(FoldCase(Bytes[1])) << 8) | uint32(FoldCase(Bytes[2]));
+    }
+
+    // Whether Text contains the already case-folded Query, ignoring ASCII case
+    bool ContainsFolded(FUtf8StringView Text, const TArray<uint8>& Query)
+    {
+        const int32 QueryLength = Query.Num();
+        const uint8* Bytes = reinterpret_cast<const uint8*>(Text.GetData());
+        for (int32 Start = 0; Start <= Text.Len() - QueryLength; ++Start)
+        {
+            if (FoldCase(Bytes[Start]) != Query[0])
+            {
+                continue;
+            }
+            int32 Matched = 1;
+            while (Matched < QueryLength && FoldCase(Bytes[Start + Matched]) == Query[Matched])
+            {
+                ++Matched;
+            }
+            if (Matched == QueryLength)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Gives each distinct string an id in order of first appearance
+    class FStringInterner
+    {
+    public:
+        explicit FStringInterner(TArray<FUtf8StringView>& InStrings)
+            : Strings(InStrings)
+        {
+        }
+
+        static uint32 Hash(FUtf8StringView String)
+        {
+            return FCrc::MemCrc32(String.GetData(), String.Len());
+        }
+
+        // Id of a string interned before, or INDEX_NONE
+        int32 Find(FUtf8StringView String, uint32 StringHash) const
+        {
+            const int32* First = FirstWithHash.Find(StringHash);
+            for (int32 Id = First ? *First : INDEX_NONE; Id != INDEX_NONE; Id = NextWithHash[Id])
+            {
+                if (Strings[Id].Len() == String.Len() && FMemory::Memcmp(Strings[Id].GetData(), String.GetData(), String.Len()) == 0)
+                {
+                    return Id;
+                }
+            }
+            return INDEX_NONE;
+        }
+
+        // Intern a string Find doesn't know; its text must outlive the interner
+        int32 Add(FUtf8StringView String, uint32 StringHash)
+        {
+            const int32* First = FirstWithHash.Find(StringHash);
+            const int32 Id = Strings.Add(String);
+            NextWithHash.Add(First ? *First : INDEX_NONE);
+            FirstWithHash.Add(StringHash, Id);
+            return Id;
+        }
+
+        int32 Intern(FUtf8StringView String)
+        {
+            const uint32 StringHash = Hash(String);
+            const int32 Id = Find(String, StringHash);
+            return Id != INDEX_NONE ? Id : Add(String, StringHash);
+        }
+
+    private:
+        TArray<FUtf8StringView>& Strings;
+        TMap<uint32, int32> FirstWithHash;
+        TArray<int32> NextWithHash;
+    };
+
+    // Copy of Text in the last of Blocks, or in a new one once it is full; a block never grows past
+    // what it reserved, so views into it stay valid
+    FUtf8StringView AddText(TArray<TArray<UTF8CHAR>>& Blocks, FUtf8StringView Text)
+    {
+        if (Blocks.Num() == 0 || Blocks.Last().Max() - Blocks.Last().Num() < Text.Len())
+        {
+            Blocks.AddDefaulted_GetRef().Reserve(FMath::Max(TextBlockBytes, Text.Len()));
+        }
+        TArray<UTF8CHAR>& Block = Blocks.Last();
+        const int32 Start = Block.Num();
+        Block.Append(Text.GetData(), Text.Len());
+        return FUtf8StringView(Block.GetData() + Start, Text.Len());
+    }
+
+    bool IsSpace(uint8 C)
+    {
+        return C == ' ' || C == '\t' || C == '\n' || C == '\r';
+    }
+
+    bool IsDigit(uint8 C)
+    {
+        return C >= '0' && C <= '9';
+    }
+
+    // Whether the text of a number is also how the store displays it: an integer int64 holds, other
+    // than -0. JSON has no leading zeros, so 19-digit integers compare to the limits as text.
+    bool IsDisplayedAsWritten(FUtf8StringView Text)
+    {
+        const bool bNegative = Text[0] == '-';
+        const FUtf8StringView Digits = Text.RightChop(bNegative ? 1 : 0);
+        if (Digits.Len() == 0 || Digits.Len() > 19 || (bNegative && Digits.Len() == 1 && Digits[0] == '0'))
+        {
+            return false;
+        }
+        for (const UTF8CHAR Char : Digits)
+        {
+            if (!IsDigit(uint8(Char)))
+            {
+                return false;
+            }
+        }
+        return Digits.Len() < 19 || FMemory::Memcmp(Digits.GetData(), bNegative ? "9223372036854775808" : "9223372036854775807", 19) <= 0;
+    }
+
+    // Fill the node lists of interned strings from the string id of every node
+    void BuildPostings(TArray<uint32>& OutOffsets, TArray<uint32>& OutNodes, int32 NumStrings, int32 NumNodes, TFunctionRef<int32(int32)> GetStringId)
+    {
+        OutOffsets.Init(0, NumStrings + 1);
+        for (int32 Node = 0; Node < NumNodes; ++Node)
+        {
+            const int32 Id = GetStringId(Node);
+            if (Id != INDEX_NONE)
+            {
+                ++OutOffsets[Id + 1];
+            }
+        }
+        for (int32 Id = 0; Id < NumStrings; ++Id)
+        {
+            OutOffsets[Id + 1] += OutOffsets[Id];
+        }
+
+        // Nodes are numbered in document order, so each list comes out in document order
+        TArray<uint32> Cursors(OutOffsets.GetData(), NumStrings);
+        OutNodes.SetNumUninitialized(OutOffsets[NumStrings]);
+        for (int32 Node = 0; Node < NumNodes; ++Node)
+        {
+            const int32 Id = GetStringId(Node);
+            if (Id != INDEX_NONE)
+            {
+                OutNodes[Cursors[Id]++] = uint32(Node);
+            }
+        }
+    }
+}
+
+TSharedPtr<FJsonTreeSearchIndex, ESPMode::ThreadSafe> FJsonTreeSearchIndex::Build(const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe>& Source, const FThreadSafeBool& bCancelled)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeSearchIndex::Build");
+    TSharedRef<FJsonTreeSearchIndex, ESPMode::ThreadSafe> Index = MakeShared<FJsonTreeSearchIndex, ESPMode::ThreadSafe>();
+
+    Index->Source = Source;
+    const uint8* Data = Source->GetData();
+    const int64 Size = Source->Num();
+
+    // The text was validated when the document was loaded, so the walk only checks as much as it
+    // needs to find its way. Each value gets a node as its first token is read.
+    FStringInterner KeyInterner(Index->Keys.Strings);
+    FStringInterner ValueInterner(Index->Values.Strings);
+    TArray<int32> NodeValues;
+
+    // Numbers go by their text, and each distinct text is formatted for display once
+    TArray<FUtf8StringView> NumberTexts;
+    FStringInterner NumberInterner(NumberTexts);
+    TArray<int32> NumberValues;
+
+    // Text of the string at Pos, unescaped into Unescaped if it has escapes; Pos ends past it
+    int64 Pos = 0;
+    TArray<UTF8CHAR> Unescaped;
+    auto ReadString = [&](FUtf8StringView& OutText, bool& bOutEscaped)
+    {
+        const int64 Start = ++Pos;
+        bOutEscaped = false;
+        while (Pos < Size && Data[Pos] != '"')
+        {
+            bOutEscaped |= Data[Pos] == '\\';
+            Pos += Data[Pos] == '\\' ? 2 : 1;
+        }
+        if (Pos >= Size)
+        {
+            return false;
+        }
+        const int64 End = Pos++;
+        if (!bOutEscaped)
+        {
+            OutText = FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Data + Start), int32(End - Start));
+            return true;
+        }
+        Unescaped.Reset();
+        if (!FJsonTreeParser::UnescapeString(Data + Start, End - Start, Unescaped))
+        {
+            return false;
+        }
+        OutText = FUtf8StringView(Unescaped.GetData(), Unescaped.Num());
+        return true;
+    };
+
+    // Only unescaped text that is new gets copied out of the scratch buffer
+    auto InternText = [&Index](FStringInterner& Interner, FUtf8StringView Text, bool bCopy)
+    {
+        const uint32 TextHash = FStringInterner::Hash(Text);
+        const int32 Id = Interner.Find(Text, TextHash);
+        return Id != INDEX_NONE ? Id : Interner.Add(bCopy ? AddText(Index->TextBlocks, Text) : Text, TextHash);
+    };
+
+    // Open objects and arrays, with the members of each open object by name id to number repeated names
+    struct FFrame
+    {
+        uint32 Node;
+        uint32 NumChildren;
+        bool bObject;
+    };
+    TArray<FFrame, TInlineAllocator<64>> Stack;
+    TArray<TMap<int32, uint32>, TInlineAllocator<64>> MemberCounts;
+
+    enum class EExpect : uint8 { Value, Key, CommaOrEnd };
+    EExpect Expect = EExpect::Value;
+    int32 Key = INDEX_NONE;
+    for (int64 NumTokens = 1; ; ++NumTokens)
+    {
+        while (Pos < Size && IsSpace(Data[Pos]))
+        {
+            ++Pos;
+        }
+        if (Pos >= Size)
+        {
+            break;
+        }
+        if (NumTokens % CancelCheckInterval == 0 && bCancelled)
+        {
+            return nullptr;
+        }
+
+        const uint8 C = Data[Pos];
+        if (Expect == EExpect::CommaOrEnd)
+        {
+            if (Stack.Num() == 0)
+            {
+                return nullptr;
+            }
+            if (C == ',')
+            {
+                ++Pos;
+                Expect = Stack.Last().bObject ? EExpect::Key : EExpect::Value;
+            }
+            else if (C == (Stack.Last().bObject ? '}' : ']'))
+            {
+                ++Pos;
+                Stack.Pop(EAllowShrinking::No);
+            }
+            else
+            {
+                return nullptr;
+            }
+            continue;
+        }
+
+        if (Expect == EExpect::Key)
+        {
+            FUtf8StringView Text;
+            bool bEscaped = false;
+            if (C != '"' || !ReadString(Text, bEscaped))
+            {
+                return nullptr;
+            }
+            Key = InternText(KeyInterner, Text, bEscaped);
+            while (Pos < Size && IsSpace(Data[Pos]))
+            {
+                ++Pos;
+            }
+            if (Pos >= Size || Data[Pos] != ':')
+            {
+                return nullptr;
+            }
+            ++Pos;
+            Expect = EExpect::Value;
+            continue;
+        }
+
+        // Only whitespace may follow the root
+        const uint32 Node = uint32(Index->Parents.Num());
+        if (Stack.Num() == 0 && Node > 0)
+        {
+            return nullptr;
+        }
+        if (Stack.Num() == 0)
+        {
+            Index->Parents.Add(FJsonTreeNodeStore::InvalidIndex);
+            Index->NodeKeys.Add(0);
+        }
+        else
+        {
+            FFrame& Parent = Stack.Last();
+            Index->Parents.Add(Parent.Node);
+            if (Parent.bObject)
+            {
+                Index->NodeKeys.Add(uint32(Key));
+                uint32& Count = MemberCounts[Stack.Num() - 1].FindOrAdd(Key, 0);
+                if (Count > 0)
+                {
+                    Index->RepeatedKeys.Add(Node, Count);
+                }
+                ++Count;
+            }
+            else
+            {
+                Index->NodeKeys.Add(Parent.NumChildren);
+            }
+            ++Parent.NumChildren;
+        }
+        Index->Objects.Add(C == '{');
+
+        int32 Value = INDEX_NONE;
+        Expect = EExpect::CommaOrEnd;
+        if (C == '{' || C == '[')
+        {
+            ++Pos;
+            Stack.Add({ Node, 0, C == '{' });
+            if (C == '{')
+            {
+                if (MemberCounts.Num() < Stack.Num())
+                {
+                    MemberCounts.SetNum(Stack.Num());
+                }
+                MemberCounts[Stack.Num() - 1].Reset();
+            }
+
+            // An empty container closes right away
+            while (Pos < Size && IsSpace(Data[Pos]))
+            {
+                ++Pos;
+            }
+            if (Pos < Size && Data[Pos] == (C == '{' ? '}' : ']'))
+            {
+                ++Pos;
+                Stack.Pop(EAllowShrinking::No);
+            }
+            else
+            {
+                Expect = C == '{' ? EExpect::Key : EExpect::Value;
+            }
+        }
+        else if (C == '"')
+        {
+            FUtf8StringView Text;
+            bool bEscaped = false;
+            if (!ReadString(Text, bEscaped))
+            {
+                return nullptr;
+            }
+            Value = Text.IsEmpty() ? INDEX_NONE : InternText(ValueInterner, Text, bEscaped);
+        }
+        else if (C == 't' || C == 'f' || C == 'n')
+        {
+            // Literals show as written
+            const int32 Length = C == 'f' ? 5 : 4;
+            if (Pos + Length > Size)
+            {
+                return nullptr;
+            }
+            Value = ValueInterner.Intern(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Data + Pos), Length));
+            Pos += Length;
+        }
+        else if (C == '-' || IsDigit(C))
+        {
+            const int64 Start = Pos;
+            while (Pos < Size && (IsDigit(Data[Pos]) || Data[Pos] == '-' || Data[Pos] == '+' || Data[Pos] == '.' || Data[Pos] == 'e' || Data[Pos] == 'E'))
+            {
+                ++Pos;
+            }
+            const FUtf8StringView Text(reinterpret_cast<const UTF8CHAR*>(Data + Start), int32(Pos - Start));
+            const int32 Number = NumberInterner.Intern(Text);
+            if (Number == NumberValues.Num())
+            {
+                // Fractions show as a sanitized double, like FJsonTreeNodeStore::GetValueString
+                if (IsDisplayedAsWritten(Text))
+                {
+                    NumberValues.Add(ValueInterner.Intern(Text));
+                }
+                else
+                {
+                    TArray<ANSICHAR, TInlineAllocator<64>> Token;
+                    Token.Append(reinterpret_cast<const ANSICHAR*>(Text.GetData()), Text.Len());
+                    Token.Add('\0');
+                    const FString Display = FString::SanitizeFloat(FCStringAnsi::Atod(Token.GetData()));
+                    const FTCHARToUTF8 Utf8(*Display, Display.Len());
+                    NumberValues.Add(InternText(ValueInterner, FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Utf8.Get()), Utf8.Length()), true));
+                }
+            }
+            Value = NumberValues[Number];
+        }
+        else
+        {
+            return nullptr;
+        }
+        NodeValues.Add(Value);
+    }
+    if (Stack.Num() > 0 || Index->Parents.Num() == 0)
+    {
+        return nullptr;
+    }
+
+    // Members are listed under their name id, primitives under their value id
+    const int32 NumNodes = Index->Parents.Num();
+    BuildPostings(Index->Keys.Offsets, Index->Keys.Nodes, Index->Keys.Strings.Num(), NumNodes, [&Index](int32 Node)
+    {
+        const uint32 Parent = Index->Parents[Node];
+        return Parent != FJsonTreeNodeStore::InvalidIndex && Index->Objects[Parent] ? int32(Index->NodeKeys[Node]) : INDEX_NONE;
+    });
+    BuildPostings(Index->Values.Offsets, Index->Values.Nodes, Index->Values.Strings.Num(), NumNodes, [&NodeValues](int32 Node)
+    {
+        return NodeValues[Node];
+    });
+
+    // Each distinct value lists each of its trigrams once; sorting the pairs groups them by trigram
+    TArray<uint64> Pairs;
+    TArray<uint32> ValueTrigrams;
+    for (int32 ValueId = 0; ValueId < Index->Values.Strings.Num(); ++ValueId)
+    {
+        if (ValueId % CancelCheckInterval == 0 && bCancelled)
+        {
+            return nullptr;
+        }
+
+        const FUtf8StringView Value = Index->Values.Strings[ValueId];
+        if (Value.Len() > MaxTrigramValueBytes)
+        {
+            Index->LongValues.Add(ValueId);
+            continue;
+        }
+
+        ValueTrigrams.Reset();
+        const uint8* Bytes = reinterpret_cast<const uint8*>(Value.GetData());
+        for (int32 Start = 0; Start + 3 <= Value.Len(); ++Start)
+        {
+            ValueTrigrams.Add(MakeTrigram(Bytes + Start));
+        }
+        ValueTrigrams.Sort();
+        for (int32 Trigram = 0; Trigram < ValueTrigrams.Num(); ++Trigram)
+        {
+            if (Trigram == 0 || ValueTrigrams[Trigram] != ValueTrigrams[Trigram - 1])
+            {
+                Pairs.Add((uint64(ValueTrigrams[Trigram]) << 32) | uint32(ValueId));
+            }
+        }
+    }
+    Pairs.Sort();
+
+    for (int32 Pair = 0; Pair < Pairs.Num(); ++Pair)
+    {
+        const uint32 Trigram = uint32(Pairs[Pair] >> 32);
+        if (Index->Trigrams.Num() == 0 || Index->Trigrams.Last() != Trigram)
+        {
+            Index->Trigrams.Add(Trigram);
+            Index->TrigramOffsets.Add(uint32(Pair));
+        }
+        Index->TrigramValues.Add(uint32(Pairs[Pair]));
+    }
+    Index->TrigramOffsets.Add(uint32(Pairs.Num()));
+
+    return Index;
+}
+
+bool FJsonTreeSearchIndex::Find(FUtf8StringView Query, const FThreadSafeBool& bCancelled, TArray<uint32>& OutNodes) const
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeSearchIndex::Find");
+    OutNodes.Reset();
+
+    TArray<uint8> FoldedQuery;
+    for (const UTF8CHAR Char : Query)
+    {
+        FoldedQuery.Add(FoldCase(uint8(Char)));
+    }
+    if (FoldedQuery.Num() == 0)
+    {
+        return true;
+    }
+
+    // There are few distinct keys compared to nodes, so they are simply all checked
+    TArray<int32> MatchedKeys;
+    for (int32 KeyId = 0; KeyId < Keys.Strings.Num(); ++KeyId)
+    {
+        if (KeyId % CancelCheckInterval == 0 && bCancelled)
+        {
+            return false;
+        }
+        if (ContainsFolded(Keys.Strings[KeyId], FoldedQuery))
+        {
+            MatchedKeys.Add(KeyId);
+        }
+    }
+
+    // Only values containing every trigram of the query can contain the query, and only those are checked.
+    // Queries shorter than a trigram check every value.
+    TArray<int32> Candidates;
+    if (FoldedQuery.Num() >= 3)
+    {
+        TArray<uint32> QueryTrigrams;
+        for (int32 Start = 0; Start + 3 <= FoldedQuery.Num(); ++Start)
+        {
+            QueryTrigrams.AddUnique(MakeTrigram(FoldedQuery.GetData() + Start));
+        }
+
+        TArray<TArrayView<const uint32>, TInlineAllocator<16>> Lists;
+        for (const uint32 Trigram : QueryTrigrams)
+        {
+            const int32 Found = Algo::BinarySearch(Trigrams, Trigram);
+            if (Found == INDEX_NONE)
+            {
+                Lists.Reset();
+                break;
+            }
+            Lists.Emplace(TrigramValues.GetData() + TrigramOffsets[Found], TrigramOffsets[Found + 1] - TrigramOffsets[Found]);
+        }
+
+        // Intersect starting from the shortest list, looking the rest up by binary search
+        if (Lists.Num() > 0)
+        {
+            Lists.Sort([](const TArrayView<const uint32>& A, const TArrayView<const uint32>& B) { return A.Num() < B.Num(); });
+            for (const uint32 ValueId : Lists[0])
+            {
+                bool bInAll = true;
+                for (int32 List = 1; List < Lists.Num() && bInAll; ++List)
+                {
+                    bInAll = Algo::BinarySearch(Lists[List], ValueId) != INDEX_NONE;
+                }
+                if (bInAll)
+                {
+                    Candidates.Add(int32(ValueId));
+                }
+            }
+        }
+        Candidates.Append(LongValues);
+    }
+    else
+    {
+        Candidates.SetNumUninitialized(Values.Strings.Num());
+        for (int32 ValueId = 0; ValueId < Candidates.Num(); ++ValueId)
+        {
+            Candidates[ValueId] = ValueId;
+        }
+    }
+
+    TArray<int32> MatchedValues;
+    for (int32 Candidate = 0; Candidate < Candidates.Num(); ++Candidate)
+    {
+        if (Candidate % CancelCheckInterval == 0 && bCancelled)
+        {
+            return false;
+        }
+        if (ContainsFolded(Values.Strings[Candidates[Candidate]], FoldedQuery))
+        {
+            MatchedValues.Add(Candidates[Candidate]);
+        }
+    }
+
+    // A node can match by key and by value, so the merged list is sorted and deduplicated
+    CollectNodes(Keys, MatchedKeys, OutNodes);
+    CollectNodes(Values, MatchedValues, OutNodes);
+    if (bCancelled)
+    {
+        return false;
+    }
+    OutNodes.Sort();
+    OutNodes.SetNum(Algo::Unique(OutNodes));
+    return true;
+}
+
+void FJsonTreeSearchIndex::GetPath(uint32 Node, TArray<FJsonTreePathStep>& OutPath) const
+{
+    OutPath.Reset();
+    for (uint32 Step = Node; Parents[Step] != FJsonTreeNodeStore::InvalidIndex; Step = Parents[Step])
+    {
+        FJsonTreePathStep& PathStep = OutPath.AddDefaulted_GetRef();
+        if (Objects[Parents[Step]])
+        {
+            PathStep.Key = Keys.Strings[NodeKeys[Step]];
+            PathStep.Position = RepeatedKeys.FindRef(Step);
+        }
+        else
+        {
+            PathStep.Position = NodeKeys[Step];
+            PathStep.bElement = true;
+        }
+    }
+    Algo::Reverse(OutPath);
+}
+
+void FJsonTreeSearchIndex::CollectNodes(const FPostings& Postings, const TArray<int32>& Matched, TArray<uint32>& OutNodes)
+{
+    for (const int32 Id : Matched)
+    {
+        OutNodes.Append(Postings.Nodes.GetData() + Postings.Offsets[Id], Postings.Offsets[Id + 1] - Postings.Offsets[Id]);
+    }
+}
+
+SIZE_T FJsonTreeSearchIndex::GetAllocatedSize() const
+{
+    SIZE_T Size = TextBlocks.GetAllocatedSize()
+        + Parents.GetAllocatedSize()
+        + NodeKeys.GetAllocatedSize()
+        + Objects.GetAllocatedSize()
+        + RepeatedKeys.GetAllocatedSize()
+        + Keys.GetAllocatedSize()
+        + Values.GetAllocatedSize()
+        + Trigrams.GetAllocatedSize()
+        + TrigramOffsets.GetAllocatedSize()
+        + TrigramValues.GetAllocatedSize()
+        + LongValues.GetAllocatedSize();
+    for (const TArray<UTF8CHAR>& Block : TextBlocks)
+    {
+        Size += Block.GetAllocatedSize();
+    }
+    return Size;
+}
@@ -0,0 +1,106 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeBool.h"
+#include "JsonTreeNodeStore.h"
+
+class FJsonTreeSource;
+
+/**
+ * FJsonTreeSearchIndex
+ *
+ * Substring index over the keys and values of one document, read straight from its retained text.
+ * Nodes are numbered in document order, root first, and only their parent and key are kept, which
+ * is enough to give the path of a match that the widget then follows in its own store, however
+ * that was built (lazy children, patches). Distinct keys and values are listed with the nodes that
+ * use them in document order; their text is viewed in place in the source, apart from strings with
+ * escapes and numbers, whose display text is kept. Distinct values are covered by a trigram index,
+ * so a query only verifies the values that contain all of its trigrams. Matching ignores ASCII case.
+ */
+class FJsonTreeSearchIndex
+{
+public:
+    // Index the document. Returns null if the text doesn't parse or bCancelled is raised.
+    static TSharedPtr<FJsonTreeSearchIndex, ESPMode::ThreadSafe> Build(const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe>& Source, const FThreadSafeBool& bCancelled);
+
+    // Numbers of the nodes whose key or value contains Query, in document order. Returns false if
+    // bCancelled was raised before the search finished.
+    bool Find(FUtf8StringView Query, const FThreadSafeBool& bCancelled, TArray<uint32>& OutNodes) const;
+
+    // Path from the root to a node Find returned, for FJsonTreeNodeStore::FindNodeAtPath. The keys
+    // point into the index.
+    void GetPath(uint32 Node, TArray<FJsonTreePathStep>& OutPath) const;
+
+    // Text the index views its keys and values in, which it keeps alive
+    const TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe>& GetSource() const { return Source; }
+
+    // Bytes held by the index, not counting its source
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    // Distinct strings and the nodes using each, in compressed sparse row form
+    struct FPostings
+    {
+        TArray<FUtf8StringView> Strings;
+        TArray<uint32> Offsets;         // Nodes of string I are Nodes[Offsets[I]] to Nodes[Offsets[I + 1]]
+        TArray<uint32> Nodes;
+
+        SIZE_T GetAllocatedSize() const { return Strings.GetAllocatedSize() + Offsets.GetAllocatedSize() + Nodes.GetAllocatedSize(); }
+    };
+
+    // Append the nodes that use any of the matched strings
+    static void CollectNodes(const FPostings& Postings, const TArray<int32>& Matched, TArray<uint32>& OutNodes);
+
+    // Text the strings without escapes are viewed in
+    TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> Source;
+
+    // Unescaped strings and the display text of numbers, in blocks that never move
+    TArray<TArray<UTF8CHAR>> TextBlocks;
+
+    // Per node: its parent (InvalidIndex for the root), and its key id as a member or its index as
+    // an element; which one depends on whether the parent is an object
+    TArray<uint32> Parents;
+    TArray<uint32> NodeKeys;
+    TBitArray<> Objects;
+
+    // Members whose name an earlier member of the same object has, with the number of those
+    TMap<uint32, uint32> RepeatedKeys;
+
+    FPostings Keys;
+    FPostings Values;
+
+    // Sorted distinct trigrams of the values, each with the sorted ids of the values containing it
+    TArray<uint32> Trigrams;
+    TArray<uint32> TrigramOffsets;
+    TArray<uint32> TrigramValues;
+
+    // Values too long to take apart into trigrams, which every query checks directly
+    TArray<int32> LongValues;
+};
@@ -0,0 +1,344 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "JsonTreeSnapshot.h"
+#include "JsonTreeNodeStore.h"
+#include "JsonTreeSource.h"
+#include "JsonTreeViewerStats.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Hash/xxhash.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    // "JTVC" as read on the byte order it was written with, and the layout version, which has to
+    // change along with FJsonTreeNode or anything below
+    constexpr uint32 SnapshotMagic = 0x4356544A;
+    constexpr uint32 SnapshotVersion = 1;
+
+    // Sections start on this boundary, which keeps the mapped nodes aligned
+    constexpr uint64 SectionAlignment = 64;
+
+    // Bytes hashed at each end of the text for a stamp
+    constexpr int64 SampleBytes = 64 * 1024;
+
+    // Start of a snapshot file. Offsets are in bytes from the start of the file.
+    struct FSnapshotHeader
+    {
+        uint32 Magic;
+        uint32 Version;
+        uint32 NodeSize;                // sizeof(FJsonTreeNode) of the writer
+        uint32 NumNodes;
+        FJsonTreeSnapshotStamp Stamp;
+        uint64 NodesOffset;
+        uint64 StringsOffset;
+        uint64 NumStringBytes;
+        uint64 NameOffsetsOffset;       // NumNames + 1 uint32 offsets into the name text
+        uint64 NameTextOffset;
+        uint32 NumNames;
+        uint32 NumNameTextBytes;
+    };
+
+    // Snapshots being written by SaveAsync, by snapshot path, and ones that couldn't be written,
+    // e.g. next to a read-only file, which aren't tried again
+    FCriticalSection PendingSavesLock;
+    TSet<FString> PendingSaves;
+
+    // Whether mapped nodes form a tree that stays inside the snapshot. The stamp only samples the
+    // JSON file, so a sidecar damaged on its own would otherwise be read out of bounds once browsed.
+    // Every link has to lead to a node of the table, and every node can be linked to only once, by
+    // its parent or a sibling, which keeps child lists from looping. Child lists have to be as long
+    // as their count, and text has to stay within the string pool.
+    bool AreNodesValid(const FJsonTreeNode* Nodes, uint32 NumNodes, uint64 NumStringBytes, uint32 NumNames)
+    {
+        constexpr uint32 InvalidIndex = FJsonTreeNodeStore::InvalidIndex;
+        auto IsLink = [NumNodes](uint32 Index)
+        {
+            return Index == InvalidIndex || Index < NumNodes;
+        };
+
+        TBitArray<> Linked(false, int32(NumNodes));
+        for (uint32 Index = 0; Index < NumNodes; ++Index)
+        {
+            const FJsonTreeNode& Node = Nodes[Index];
+            if (Node.Type > uint8(EJson::Object) || Node.HasPendingChildren() || Node.IsDead()
+                || !IsLink(Node.Parent) || !IsLink(Node.FirstChild) || !IsLink(Node.NextSibling)
+                || (Node.Parent == InvalidIndex) != (Index == 0) || (Index == 0 && Node.NextSibling != InvalidIndex)
+                || (!Node.HasIndexKey() && Node.Key >= NumNames)
+                || (Node.HasTextValue() && uint64(Node.Value.Offset) + Node.Value.Length >= NumStringBytes)
+                || (Node.IsContainer() ? Node.Container.Self != Index : Node.FirstChild != InvalidIndex))
+            {
+                return false;
+            }
+
+            if (Node.FirstChild != InvalidIndex)
+            {
+                if (Linked[Node.FirstChild] || Nodes[Node.FirstChild].Parent != Index)
+                {
+                    return false;
+                }
+                Linked[Node.FirstChild] = true;
+            }
+            if (Node.NextSibling != InvalidIndex)
+            {
+                if (Linked[Node.NextSibling] || Nodes[Node.NextSibling].Parent != Node.Parent)
+                {
+                    return false;
+                }
+                Linked[Node.NextSibling] = true;
+            }
+        }
+
+        // No node is linked twice, so each list ends, and walking all of them visits every node at most once
+        for (uint32 Index = 0; Index < NumNodes; ++Index)
+        {
+            uint32 NumChildren = 0;
+            for (uint32 Child = Nodes[Index].FirstChild; Child != InvalidIndex; Child = Nodes[Child].NextSibling)
+            {
+                ++NumChildren;
+            }
+            if (NumChildren != Nodes[Index].NumChildren)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+FJsonTreeSnapshotStamp FJsonTreeSnapshotStamp::Make(const FString& FilePath, const FJsonTreeSource& Source)
+{
+    FJsonTreeSnapshotStamp Stamp;
+    Stamp.SourceSize = Source.Num();
+    Stamp.SourceTimestamp = IFileManager::Get().GetTimeStamp(*FilePath).GetTicks();
+
+    FXxHash64Builder Hash;
+    const int64 HeadBytes = FMath::Min(Source.Num(), SampleBytes);
+    Hash.Update(Source.GetData(), HeadBytes);
+    const int64 TailStart = FMath::Max(HeadBytes, Source.Num() - SampleBytes);
+    Hash.Update(Source.GetData() + TailStart, Source.Num() - TailStart);
+    Stamp.SampleHash = Hash.Finalize().Hash;
+    return Stamp;
+}
+
+FString FJsonTreeSnapshot::GetPath(const FString& FilePath)
+{
+    return FilePath + TEXT(".jtvcache");
+}
+
+TSharedPtr<FJsonTreeNodeStore> FJsonTreeSnapshot::Load(const FString& FilePath, const FJsonTreeSnapshotStamp& Stamp)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeSnapshot::Load");
+    const FString Path = GetPath(FilePath);
+    if (!IFileManager::Get().FileExists(*Path))
+    {
+        return nullptr;
+    }
+
+    const TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> File = FJsonTreeSource::FromBinaryFile(Path);
+    if (!File.IsValid() || File->Num() < int64(sizeof(FSnapshotHeader)))
+    {
+        return nullptr;
+    }
+
+    FSnapshotHeader Header;
+    FMemory::Memcpy(&Header, File->GetData(), sizeof(Header));
+
+    const uint64 FileSize = uint64(File->Num());
+    auto IsInFile = [FileSize](uint64 Offset, uint64 Bytes)
+    {
+        return Offset % SectionAlignment == 0 && Offset <= FileSize && Bytes <= FileSize - Offset;
+    };
+    if (Header.Magic != SnapshotMagic || Header.Version != SnapshotVersion || Header.NodeSize != sizeof(FJsonTreeNode) || !(Header.Stamp == Stamp)
+        || Header.NumNodes == 0 || Header.NumNames == 0 || Header.NumStringBytes == 0
+        || !IsInFile(Header.NodesOffset, uint64(Header.NumNodes) * sizeof(FJsonTreeNode))
+        || !IsInFile(Header.StringsOffset, Header.NumStringBytes)
+        || !IsInFile(Header.NameOffsetsOffset, (uint64(Header.NumNames) + 1) * sizeof(uint32))
+        || !IsInFile(Header.NameTextOffset, Header.NumNameTextBytes))
+    {
+        return nullptr;
+    }
+
+    // The name table is rebuilt rather than mapped, since finding a name needs its hash. Ids come
+    // out the same, as the names are added in id order and are all distinct.
+    TSharedRef<FJsonTreeNodeStore> Store = MakeShared<FJsonTreeNodeStore>();
+    const uint8* Data = File->GetData();
+    const uint32* NameOffsets = reinterpret_cast<const uint32*>(Data + Header.NameOffsetsOffset);
+    const UTF8CHAR* NameText = reinterpret_cast<const UTF8CHAR*>(Data + Header.NameTextOffset);
+    for (uint32 Id = 1; Id < Header.NumNames; ++Id)
+    {
+        const uint32 Begin = NameOffsets[Id];
+        const uint32 End = NameOffsets[Id + 1];
+        if (Begin > End || End > Header.NumNameTextBytes || Store->Names.Add(FUtf8StringView(NameText + Begin, End - Begin)) != Id)
+        {
+            return nullptr;
+        }
+    }
+
+    // Nodes are used where they are mapped. The mapping is read-only, which is fine as a store
+    // without pending children is never written to once built, and Patch refuses snapshot stores.
+    FJsonTreeNode* Nodes = reinterpret_cast<FJsonTreeNode*>(const_cast<uint8*>(Data + Header.NodesOffset));
+    if (!AreNodesValid(Nodes, Header.NumNodes, Header.NumStringBytes, Header.NumNames))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Ignoring a damaged tree snapshot: %s"), *Path);
+        return nullptr;
+    }
+    for (uint32 First = 0; First < Header.NumNodes; First += FJsonTreeNodeStore::NodesPerBlock)
+    {
+        Store->Blocks.Add(Nodes + First);
+    }
+    Store->NumNodes = Header.NumNodes;
+    Store->Strings.Empty();
+    Store->SnapshotStrings = reinterpret_cast<const UTF8CHAR*>(Data + Header.StringsOffset);
+    Store->Snapshot = File;
+    Store->UpdateMemoryStats();
+    return Store;
+}
+
+bool FJsonTreeSnapshot::Save(const FJsonTreeNodeStore& Store, const FString& FilePath, const FJsonTreeSnapshotStamp& Stamp)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeSnapshot::Save");
+    // Pending children would need the text, and dead nodes are only left by patching and records
+    if (Store.NumNodes == 0 || Store.IsSnapshot() || Store.Source.IsValid() || Store.NumDeadNodes > 0)
+    {
+        return false;
+    }
+
+    TArray<uint32> NameOffsets;
+    NameOffsets.Reserve(Store.Names.Num() + 1);
+    NameOffsets.Add(0);
+    for (int32 Id = 0; Id < Store.Names.Num(); ++Id)
+    {
+        NameOffsets.Add(NameOffsets.Last() + uint32(Store.Names.Get(uint32(Id)).Len()));
+    }
+
+    FSnapshotHeader Header;
+    FMemory::Memzero(Header);
+    Header.Magic = SnapshotMagic;
+    Header.Version = SnapshotVersion;
+    Header.NodeSize = sizeof(FJsonTreeNode);
+    Header.NumNodes = Store.NumNodes;
+    Header.Stamp = Stamp;
+    Header.NodesOffset = Align(uint64(sizeof(FSnapshotHeader)), SectionAlignment);
+    Header.StringsOffset = Align(Header.NodesOffset + uint64(Store.NumNodes) * sizeof(FJsonTreeNode), SectionAlignment);
+    Header.NumStringBytes = uint64(Store.Strings.Num());
+    Header.NameOffsetsOffset = Align(Header.StringsOffset + Header.NumStringBytes, SectionAlignment);
+    Header.NameTextOffset = Align(Header.NameOffsetsOffset + NameOffsets.Num() * sizeof(uint32), SectionAlignment);
+    Header.NumNames = uint32(Store.Names.Num());
+    Header.NumNameTextBytes = NameOffsets.Last();
+
+    // Another widget may have the current snapshot mapped, so it is replaced rather than overwritten
+    const FString Path = GetPath(FilePath);
+    const FString TempPath = FPaths::CreateTempFilename(*FPaths::GetPath(Path), *FPaths::GetCleanFilename(Path), TEXT(".tmp"));
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TempPath));
+    if (!Writer.IsValid())
+    {
+        return false;
+    }
+
+    uint8 Padding[SectionAlignment] = {};
+    auto Write = [&Writer, &Padding](uint64 Offset, const void* Data, uint64 Bytes)
+    {
+        Writer->Serialize(Padding, int64(Offset) - Writer->Tell());
+        Writer->Serialize(const_cast<void*>(Data), int64(Bytes));
+    };
+
+    Write(0, &Header, sizeof(Header));
+    for (uint32 First = 0; First < Store.NumNodes; First += FJsonTreeNodeStore::NodesPerBlock)
+    {
+        const uint32 Count = FMath::Min(Store.NumNodes - First, FJsonTreeNodeStore::NodesPerBlock);
+        Write(Header.NodesOffset + uint64(First) * sizeof(FJsonTreeNode), Store.Blocks[First >> FJsonTreeNodeStore::BlockShift], uint64(Count) * sizeof(FJsonTreeNode));
+    }
+    Write(Header.StringsOffset, Store.Strings.GetData(), Header.NumStringBytes);
+    Write(Header.NameOffsetsOffset, NameOffsets.GetData(), NameOffsets.Num() * sizeof(uint32));
+    for (int32 Id = 0; Id < Store.Names.Num(); ++Id)
+    {
+        const FUtf8StringView Name = Store.Names.Get(uint32(Id));
+        Write(Header.NameTextOffset + NameOffsets[Id], Name.GetData(), Name.Len());
+    }
+
+    const bool bWritten = Writer->Close() && !Writer->IsError();
+    Writer.Reset();
+    if (!bWritten || !IFileManager::Get().Move(*Path, *TempPath, true, false, false, true))
+    {
+        IFileManager::Get().Delete(*TempPath, false, false, true);
+        return false;
+    }
+    return true;
+}
+
+void FJsonTreeSnapshot::SaveAsync(const TSharedRef<const FJsonTreeNodeStore>& Store, const TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe>& Source,
+    const FString& FilePath, const FJsonTreeSnapshotStamp& Stamp)
+{
+    const FString Path = GetPath(FilePath);
+    {
+        FScopeLock Lock(&PendingSavesLock);
+        if (PendingSaves.Contains(Path))
+        {
+            return;
+        }
+        PendingSaves.Add(Path);
+    }
+
+    const TWeakPtr<const FJsonTreeNodeStore> WeakStore = Store;
+    Async(EAsyncExecution::ThreadPool, [WeakStore, Source, FilePath, Path, Stamp]()
+    {
+        // The tree was released before the worker got to it, e.g. with an evicted document, so
+        // nobody is going to open it again soon
+        if (!WeakStore.IsValid())
+        {
+            FScopeLock Lock(&PendingSavesLock);
+            PendingSaves.Remove(Path);
+            return;
+        }
+
+        bool bSaved = true;
+        if (Source.IsValid())
+        {
+            FJsonTreeNodeStore Rebuilt;
+            FString Error;
+            int32 ErrorLine = 0;
+            int32 ErrorColumn = 0;
+            bSaved = !Rebuilt.Build(Source.ToSharedRef(), false, true, [](float) { return true; }, Error, ErrorLine, ErrorColumn) || Save(Rebuilt, FilePath, Stamp);
+        }
+        else
+        {
+            const TSharedPtr<const FJsonTreeNodeStore> LoadedStore = WeakStore.Pin();
+            bSaved = !LoadedStore.IsValid() || Save(*LoadedStore, FilePath, Stamp);
+        }
+        if (!bSaved)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Failed to write the tree snapshot: %s"), *Path);
+            return;
+        }
+
+        FScopeLock Lock(&PendingSavesLock);
+        PendingSaves.Remove(Path);
+    });
+}
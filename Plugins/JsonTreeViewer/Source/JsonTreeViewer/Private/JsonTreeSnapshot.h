@@ -0,0 +1,82 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonTreeNodeStore;
+class FJsonTreeSource;
+
+// Identifies the version of a JSON file a snapshot was made from
+struct FJsonTreeSnapshotStamp
+{
+    int64 SourceSize = 0;           // Bytes of UTF-8 text
+    int64 SourceTimestamp = 0;      // Modification time of the file, in ticks
+    uint64 SampleHash = 0;          // Hash of the first and last 64 KB of the text
+
+    // Stamp of a file as it is now; hashing samples rather than all of the text keeps this cheap for huge files
+    static FJsonTreeSnapshotStamp Make(const FString& FilePath, const FJsonTreeSource& Source);
+
+    bool operator==(const FJsonTreeSnapshotStamp& Other) const
+    {
+        return SourceSize == Other.SourceSize && SourceTimestamp == Other.SourceTimestamp && SampleHash == Other.SampleHash;
+    }
+};
+
+/**
+ * FJsonTreeSnapshot
+ *
+ * Sidecar file next to a JSON file (<file>.jtvcache) holding its fully built node store: the
+ * node table, the string pool and the name table. Nodes and strings are written exactly as they
+ * are held in memory, so a later open maps the file and reads them in place. Reopening then
+ * takes one pass over the nodes, which checks that their links and text stay inside the file,
+ * and only the strings of the rows on screen are read from disk. Only the name table is copied,
+ * since looking names up needs its hash.
+ */
+class FJsonTreeSnapshot
+{
+public:
+    // Snapshot file of a JSON file
+    static FString GetPath(const FString& FilePath);
+
+    // Store reading the snapshot of a file in place, or null if there is none, it was made from
+    // another version of the file, it was written by another version of the plugin, or it is damaged
+    static TSharedPtr<FJsonTreeNodeStore> Load(const FString& FilePath, const FJsonTreeSnapshotStamp& Stamp);
+
+    // Write the snapshot of a fully built store. The file is written under a temporary name and
+    // moved into place, so a reader never maps a partial one.
+    static bool Save(const FJsonTreeNodeStore& Store, const FString& FilePath, const FJsonTreeSnapshotStamp& Stamp);
+
+    // Save the snapshot of a loaded store on a worker thread, unless the snapshot of the same file is
+    // being written already or failed to be written before. A store that never changes, such as a
+    // document's, is saved as it is; given the Source, the worker instead builds the whole tree from
+    // it, for a store that may be lazy or patched on the game thread meanwhile. The store is only
+    // held weakly, and the save is skipped once it has been released, e.g. with an evicted document.
+    static void SaveAsync(const TSharedRef<const FJsonTreeNodeStore>& Store, const TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe>& Source,
+        const FString& FilePath, const FJsonTreeSnapshotStamp& Stamp);
+};
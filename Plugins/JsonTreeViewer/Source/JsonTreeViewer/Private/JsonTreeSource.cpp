@@ -0,0 +1,160 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "JsonTreeSource.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+FJsonTreeSource::FJsonTreeSource()
+    : Data(nullptr)
+    , Size(0)
+{
+}
+
+FJsonTreeSource::~FJsonTreeSource()
+{
+    // The region has to be unmapped before the file handle closes
+    MappedRegion.Reset();
+    MappedFile.Reset();
+}
+
+TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> FJsonTreeSource::FromFile(const FString& FilePath)
+{
+    TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe> Source = MakeShareable(new FJsonTreeSource());
+    if (!Source->Open(FilePath))
+    {
+        return nullptr;
+    }
+    Source->SetView(Source->Data, Source->Size);
+
+    // UTF-16 files still need the engine's conversion
+    const bool bUtf16 = Source->Size >= 2
+        && ((Source->Data[0] == 0xFF && Source->Data[1] == 0xFE) || (Source->Data[0] == 0xFE && Source->Data[1] == 0xFF));
+    if (bUtf16)
+    {
+        FString JsonString;
+        if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+        {
+            return nullptr;
+        }
+        return FromString(JsonString);
+    }
+
+    return Source;
+}
+
+TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> FJsonTreeSource::FromBinaryFile(const FString& FilePath)
+{
+    TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe> Source = MakeShareable(new FJsonTreeSource());
+    if (!Source->Open(FilePath) || Source->Size == 0)
+    {
+        return nullptr;
+    }
+    return Source;
+}
+
+TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe> FJsonTreeSource::FromString(const FString& JsonString)
+{
+    TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe> Source = MakeShareable(new FJsonTreeSource());
+
+    FTCHARToUTF8 Utf8(*JsonString, JsonString.Len());
+    Source->Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+    Source->SetView(Source->Bytes.GetData(), Source->Bytes.Num());
+    return Source;
+}
+
+TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe> FJsonTreeSource::FromStream(int64 ExpectedBytes)
+{
+    TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe> Source = MakeShareable(new FJsonTreeSource());
+    Source->Bytes.Reserve(int32(FMath::Clamp<int64>(ExpectedBytes, 0, MAX_int32)));
+    Source->Data = Source->Bytes.GetData();
+    return Source;
+}
+
+bool FJsonTreeSource::AppendStream(TConstArrayView<uint8> InBytes)
+{
+    if (int64(Bytes.Num()) + InBytes.Num() > int64(MAX_int32))
+    {
+        return false;
+    }
+
+    Bytes.Append(InBytes.GetData(), InBytes.Num());
+    if (Bytes.Num() >= 3)
+    {
+        SetView(Bytes.GetData(), Bytes.Num());
+    }
+    return true;
+}
+
+void FJsonTreeSource::FinishStream()
+{
+    SetView(Bytes.GetData(), Bytes.Num());
+}
+
+bool FJsonTreeSource::Open(const FString& FilePath)
+{
+    // Map the whole file so pages are read on demand straight into the parser
+    IMappedFileHandle* Handle = FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath);
+    if (Handle && Handle->GetFileSize() > 0)
+    {
+        MappedFile.Reset(Handle);
+        MappedRegion.Reset(Handle->MapRegion(0, Handle->GetFileSize()));
+    }
+    else
+    {
+        delete Handle;
+    }
+
+    if (MappedRegion.IsValid())
+    {
+        Data = MappedRegion->GetMappedPtr();
+        Size = MappedRegion->GetMappedSize();
+    }
+    else
+    {
+        MappedFile.Reset();
+        if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+        {
+            return false;
+        }
+        Data = Bytes.GetData();
+        Size = Bytes.Num();
+    }
+    return true;
+}
+
+void FJsonTreeSource::SetView(const uint8* InData, int64 InSize)
+{
+    Data = InData;
+    Size = InSize;
+    if (Size >= 3 && Data[0] == 0xEF && Data[1] == 0xBB && Data[2] == 0xBF)
+    {
+        Data += 3;
+        Size -= 3;
+    }
+}
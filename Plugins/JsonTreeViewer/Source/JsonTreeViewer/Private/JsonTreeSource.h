@@ -0,0 +1,90 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * FJsonTreeSource
+ *
+ * Read-only UTF-8 bytes of a JSON document. Files are memory-mapped where the platform
+ * supports it, so the parser reads the file in place without a widened TCHAR copy. Tree
+ * snapshots are mapped the same way. A stream source grows as the bytes of a download arrive.
+ */
+class FJsonTreeSource
+{
+public:
+    ~FJsonTreeSource();
+
+    // Map a file, or read its bytes when mapping isn't available. Returns null if the file can't be read.
+    static TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> FromFile(const FString& FilePath);
+
+    // Map a file as it is, without looking for a byte order mark or UTF-16, e.g. a tree snapshot.
+    // Returns null if the file is empty or can't be read.
+    static TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> FromBinaryFile(const FString& FilePath);
+
+    // UTF-8 copy of an in-memory JSON string
+    static TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe> FromString(const FString& JsonString);
+
+    // Empty source that AppendStream fills, with room for ExpectedBytes if that is known
+    static TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe> FromStream(int64 ExpectedBytes);
+
+    // Append the next bytes of a stream source. The bytes only become visible once there are three of
+    // them, or at FinishStream, so a byte order mark is skipped however the stream is split. GetData
+    // may move. Returns false if the source can't hold that much.
+    bool AppendStream(TConstArrayView<uint8> InBytes);
+    void FinishStream();
+
+    // First byte of the document (after any byte order mark)
+    const uint8* GetData() const { return Data; }
+
+    // Number of bytes in the document
+    int64 Num() const { return Size; }
+
+    // Whether the bytes are a view of a memory-mapped file
+    bool IsMapped() const { return MappedRegion.IsValid(); }
+
+private:
+    FJsonTreeSource();
+
+    // Map a file, or read it when mapping isn't available, and point Data/Size at all of it
+    bool Open(const FString& FilePath);
+
+    // Point Data/Size at a buffer, skipping a UTF-8 byte order mark
+    void SetView(const uint8* InData, int64 InSize);
+
+    TUniquePtr<IMappedFileHandle> MappedFile;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+    TArray<uint8> Bytes;
+
+    const uint8* Data;
+    int64 Size;
+};
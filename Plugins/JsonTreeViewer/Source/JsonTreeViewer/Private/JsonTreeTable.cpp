@@ -0,0 +1,582 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "JsonTreeTable.h"
+#include "JsonTreeNodeStore.h"
+#include "JsonTreeViewerStats.h"
+#include "Hash/xxhash.h"
+#include <limits>
+
+#if PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#elif PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#include <arm_neon.h>
+#endif
+
+namespace
+{
+    // Value types seen in a column while it is being laid out, one bit each
+    enum EKindBits : uint32
+    {
+        KindNull      = 1 << 0,
+        KindBoolean   = 1 << 1,
+        KindInteger   = 1 << 2,
+        KindFraction  = 1 << 3,
+        KindString    = 1 << 4,
+        KindContainer = 1 << 5,
+    };
+
+    uint32 GetKindBit(const FJsonTreeNode& Node)
+    {
+        switch (Node.GetType())
+        {
+        case EJson::Null:    return KindNull;
+        case EJson::Boolean: return KindBoolean;
+        case EJson::Number:  return Node.IsInteger() ? KindInteger : KindFraction;
+        case EJson::String:  return KindString;
+        default:             return KindContainer;
+        }
+    }
+
+    // A column holds one type of value, give or take nulls and missing members
+    EJsonTreeColumnType GetTypeOfKinds(uint32 Kinds)
+    {
+        Kinds &= ~KindNull;
+        switch (Kinds)
+        {
+        case 0:                             return EJsonTreeColumnType::Null;
+        case KindBoolean:                   return EJsonTreeColumnType::Boolean;
+        case KindInteger:                   return EJsonTreeColumnType::Integer;
+        case KindFraction:
+        case KindInteger | KindFraction:    return EJsonTreeColumnType::Number;
+        case KindString:                    return EJsonTreeColumnType::String;
+        default:                            return EJsonTreeColumnType::Mixed;
+        }
+    }
+
+    // Sort key that orders doubles as unsigned integers: negative numbers have all their bits
+    // flipped, positive ones only the sign bit
+    uint64 GetNumberKey(double Value)
+    {
+        uint64 Bits;
+        FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+        return (Bits & (uint64(1) << 63)) ? ~Bits : Bits | (uint64(1) << 63);
+    }
+
+    // Least significant digit first, so every pass keeps the order of the one before it and the
+    // sort is stable. Passes whose digit is the same for every key are skipped.
+    void RadixSort(TArray<uint64>& Keys, TArray<int32>& Rows)
+    {
+        constexpr int32 DigitBits = 11;
+        constexpr int32 NumBuckets = 1 << DigitBits;
+        constexpr int32 NumPasses = (64 + DigitBits - 1) / DigitBits;
+
+        const int32 Num = Keys.Num();
+        TArray<int32> Counts;
+        Counts.SetNumZeroed(NumPasses * NumBuckets);
+        for (const uint64 Key : Keys)
+        {
+            for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+            {
+                ++Counts[Pass * NumBuckets + int32((Key >> (Pass * DigitBits)) & (NumBuckets - 1))];
+            }
+        }
+
+        TArray<uint64> SortedKeys;
+        TArray<int32> SortedRows;
+        SortedKeys.SetNumUninitialized(Num);
+        SortedRows.SetNumUninitialized(Num);
+        for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+        {
+            int32* PassCounts = Counts.GetData() + Pass * NumBuckets;
+            const int32 Shift = Pass * DigitBits;
+            if (PassCounts[(Keys[0] >> Shift) & (NumBuckets - 1)] == Num)
+            {
+                continue;
+            }
+
+            // Turn the counts into the position of each bucket's first key
+            int32 Position = 0;
+            for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+            {
+                const int32 Count = PassCounts[Bucket];
+                PassCounts[Bucket] = Position;
+                Position += Count;
+            }
+            for (int32 Index = 0; Index < Num; ++Index)
+            {
+                const int32 Target = PassCounts[(Keys[Index] >> Shift) & (NumBuckets - 1)]++;
+                SortedKeys[Target] = Keys[Index];
+                SortedRows[Target] = Rows[Index];
+            }
+            Swap(Keys, SortedKeys);
+            Swap(Rows, SortedRows);
+        }
+    }
+
+    // Smallest, largest and sum of the values of a number column, skipping the NaNs of rows
+    // without one. Two doubles at a time: MINPD and MAXPD return their second operand when the
+    // first is NaN, and the sum masks NaNs to zero.
+    void SummarizeNumbers(const double* Values, int32 Num, double& OutMin, double& OutMax, double& OutSum)
+    {
+        double Min = TNumericLimits<double>::Max();
+        double Max = TNumericLimits<double>::Lowest();
+        double Sum = 0.0;
+        int32 Index = 0;
+#if PLATFORM_CPU_X86_FAMILY
+        __m128d MinAcc = _mm_set1_pd(Min);
+        __m128d MaxAcc = _mm_set1_pd(Max);
+        __m128d SumAcc = _mm_setzero_pd();
+        for (; Index + 2 <= Num; Index += 2)
+        {
+            const __m128d V = _mm_loadu_pd(Values + Index);
+            MinAcc = _mm_min_pd(V, MinAcc);
+            MaxAcc = _mm_max_pd(V, MaxAcc);
+            SumAcc = _mm_add_pd(SumAcc, _mm_and_pd(V, _mm_cmpord_pd(V, V)));
+        }
+        double Lanes[2];
+        _mm_storeu_pd(Lanes, MinAcc);
+        Min = FMath::Min(Lanes[0], Lanes[1]);
+        _mm_storeu_pd(Lanes, MaxAcc);
+        Max = FMath::Max(Lanes[0], Lanes[1]);
+        _mm_storeu_pd(Lanes, SumAcc);
+        Sum = Lanes[0] + Lanes[1];
+#elif PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+        // FMINNM and FMAXNM take the number when the other operand is NaN
+        float64x2_t MinAcc = vdupq_n_f64(Min);
+        float64x2_t MaxAcc = vdupq_n_f64(Max);
+        float64x2_t SumAcc = vdupq_n_f64(0.0);
+        for (; Index + 2 <= Num; Index += 2)
+        {
+            const float64x2_t V = vld1q_f64(Values + Index);
+            MinAcc = vminnmq_f64(MinAcc, V);
+            MaxAcc = vmaxnmq_f64(MaxAcc, V);
+            SumAcc = vaddq_f64(SumAcc, vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(V), vceqq_f64(V, V))));
+        }
+        Min = vminnmvq_f64(MinAcc);
+        Max = vmaxnmvq_f64(MaxAcc);
+        Sum = vaddvq_f64(SumAcc);
+#endif
+        for (; Index < Num; ++Index)
+        {
+            const double V = Values[Index];
+            if (V == V)
+            {
+                Min = FMath::Min(Min, V);
+                Max = FMath::Max(Max, V);
+                Sum += V;
+            }
+        }
+        OutMin = Min;
+        OutMax = Max;
+        OutSum = Sum;
+    }
+
+    // Smallest, largest and sum of the values of an integer column. Rows without a value hold
+    // zero, so the sum needs no mask and only the range looks at the cell types; the compiler is
+    // left to vectorize the loop, since SSE2 has no 64-bit integer compare.
+    void SummarizeIntegers(const int64* Values, const uint8* Kinds, int32 Num, int64& OutMin, int64& OutMax, double& OutSum)
+    {
+        int64 Min = MAX_int64;
+        int64 Max = MIN_int64;
+        double Sum = 0.0;
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            const int64 V = Values[Index];
+            const bool bValue = Kinds[Index] == uint8(EJson::Number);
+            Min = bValue && V < Min ? V : Min;
+            Max = bValue && V > Max ? V : Max;
+            Sum += double(V);
+        }
+        OutMin = Min;
+        OutMax = Max;
+        OutSum = Sum;
+    }
+}
+
+FJsonTreeTable::FJsonTreeTable(const TSharedRef<const FJsonTreeNodeStore>& InStore)
+    : Store(InStore)
+{
+}
+
+TSharedPtr<FJsonTreeTable> FJsonTreeTable::Build(const TSharedRef<const FJsonTreeNodeStore>& InStore, uint32 ArrayIndex)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeTable::Build");
+    const FJsonTreeNodeStore& NodeStore = *InStore;
+    const FJsonTreeNode& Array = NodeStore.GetNode(ArrayIndex);
+    if (Array.GetType() != EJson::Array || Array.IsDead() || Array.HasPendingChildren())
+    {
+        return nullptr;
+    }
+
+    // Large arrays list their elements through pages
+    TSharedRef<FJsonTreeTable> Table = MakeShareable(new FJsonTreeTable(InStore));
+    TArray<uint32>& Rows = Table->Rows;
+    for (uint32 Child = Array.FirstChild; Child != FJsonTreeNodeStore::InvalidIndex; Child = NodeStore.GetNode(Child).NextSibling)
+    {
+        const FJsonTreeNode& ChildNode = NodeStore.GetNode(Child);
+        if (!ChildNode.IsPage())
+        {
+            Rows.Add(Child);
+            continue;
+        }
+        for (uint32 Element = ChildNode.FirstChild; Element != FJsonTreeNodeStore::InvalidIndex; Element = NodeStore.GetNode(Element).NextSibling)
+        {
+            Rows.Add(Element);
+        }
+    }
+    if (Rows.Num() == 0)
+    {
+        return nullptr;
+    }
+    for (const uint32 Row : Rows)
+    {
+        const FJsonTreeNode& Element = NodeStore.GetNode(Row);
+        if (Element.GetType() != EJson::Object || Element.HasPendingChildren())
+        {
+            return nullptr;
+        }
+    }
+
+    // First pass: the columns and the types each of them holds. A member name repeated within one
+    // object only counts the first time, like a lookup by name.
+    TArray<int32> ColumnOfName;
+    ColumnOfName.Init(INDEX_NONE, NodeStore.GetNumNames());
+    TArray<uint32> ColumnKinds;
+    TArray<int32> LastRow;
+    for (int32 Row = 0; Row < Rows.Num(); ++Row)
+    {
+        for (uint32 Member = NodeStore.GetNode(Rows[Row]).FirstChild; Member != FJsonTreeNodeStore::InvalidIndex; Member = NodeStore.GetNode(Member).NextSibling)
+        {
+            const FJsonTreeNode& MemberNode = NodeStore.GetNode(Member);
+            int32& Column = ColumnOfName[MemberNode.Key];
+            if (Column == INDEX_NONE)
+            {
+                if (ColumnKinds.Num() == MaxColumns)
+                {
+                    return nullptr;
+                }
+                Column = ColumnKinds.Add(0);
+                LastRow.Add(INDEX_NONE);
+                Table->Columns.AddDefaulted_GetRef().Name = NodeStore.GetKeyString(MemberNode);
+            }
+            if (LastRow[Column] != Row)
+            {
+                LastRow[Column] = Row;
+                ColumnKinds[Column] |= GetKindBit(MemberNode);
+            }
+        }
+    }
+
+    const int32 NumRows = Rows.Num();
+    for (int32 Column = 0; Column < Table->Columns.Num(); ++Column)
+    {
+        FColumn& Col = Table->Columns[Column];
+        Col.Type = GetTypeOfKinds(ColumnKinds[Column]);
+        Col.Kinds.SetNumZeroed(NumRows);
+        Col.Nodes.Init(FJsonTreeNodeStore::InvalidIndex, NumRows);
+        switch (Col.Type)
+        {
+        case EJsonTreeColumnType::Boolean: Col.Booleans.SetNumZeroed(NumRows); break;
+        case EJsonTreeColumnType::Integer: Col.Integers.SetNumZeroed(NumRows); break;
+        case EJsonTreeColumnType::Number:  Col.Numbers.Init(std::numeric_limits<double>::quiet_NaN(), NumRows); break;
+        case EJsonTreeColumnType::String:  Col.Strings.SetNumZeroed(NumRows); break;
+        default:                           break;
+        }
+        LastRow[Column] = INDEX_NONE;
+    }
+
+    // Second pass: the values. Equal strings share an id, found by hash.
+    TMap<uint64, uint32> FirstWithHash;
+    TArray<uint32> NextWithHash;
+    for (int32 Row = 0; Row < NumRows; ++Row)
+    {
+        for (uint32 Member = NodeStore.GetNode(Rows[Row]).FirstChild; Member != FJsonTreeNodeStore::InvalidIndex; Member = NodeStore.GetNode(Member).NextSibling)
+        {
+            const FJsonTreeNode& MemberNode = NodeStore.GetNode(Member);
+            const int32 Column = ColumnOfName[MemberNode.Key];
+            if (LastRow[Column] == Row)
+            {
+                continue;
+            }
+            LastRow[Column] = Row;
+
+            FColumn& Col = Table->Columns[Column];
+            const EJson Type = MemberNode.GetType();
+            Col.Kinds[Row] = uint8(Type);
+            Col.Nodes[Row] = Member;
+            switch (Col.Type)
+            {
+            case EJsonTreeColumnType::Boolean:
+                if (Type == EJson::Boolean)
+                {
+                    Col.Booleans[Row] = NodeStore.IsTrue(MemberNode);
+                    ++Col.NumValues;
+                }
+                break;
+
+            case EJsonTreeColumnType::Integer:
+                if (Type == EJson::Number)
+                {
+                    Col.Integers[Row] = MemberNode.Integer;
+                    ++Col.NumValues;
+                }
+                break;
+
+            case EJsonTreeColumnType::Number:
+                if (Type == EJson::Number)
+                {
+                    Col.Numbers[Row] = MemberNode.GetNumber();
+                    ++Col.NumValues;
+                }
+                break;
+
+            case EJsonTreeColumnType::String:
+                if (Type == EJson::String)
+                {
+                    const FUtf8StringView Value = NodeStore.GetValue(MemberNode);
+                    const uint64 Hash = FXxHash64::HashBuffer(Value.GetData(), Value.Len()).Hash;
+                    const uint32* First = FirstWithHash.Find(Hash);
+                    uint32 Id = First ? *First : FJsonTreeNodeStore::InvalidIndex;
+                    while (Id != FJsonTreeNodeStore::InvalidIndex && !NodeStore.GetValue(NodeStore.GetNode(Table->DistinctStrings[Id])).Equals(Value))
+                    {
+                        Id = NextWithHash[Id];
+                    }
+                    if (Id == FJsonTreeNodeStore::InvalidIndex)
+                    {
+                        Id = uint32(Table->DistinctStrings.Add(Member));
+                        NextWithHash.Add(First ? *First : FJsonTreeNodeStore::InvalidIndex);
+                        FirstWithHash.Add(Hash, Id);
+                    }
+                    Col.Strings[Row] = Id;
+                    ++Col.NumValues;
+                }
+                break;
+
+            case EJsonTreeColumnType::Mixed:
+                ++Col.NumValues;
+                break;
+
+            default:
+                break;
+            }
+        }
+    }
+    return Table;
+}
+
+int32 FJsonTreeTable::FindColumn(const FString& Name) const
+{
+    return Columns.IndexOfByPredicate([&Name](const FColumn& Column) { return Column.Name.Equals(Name, ESearchCase::CaseSensitive); });
+}
+
+FString FJsonTreeTable::GetCellString(int32 Column, int32 Row, int32 MaxChars) const
+{
+    const FColumn& Col = Columns[Column];
+    switch (EJson(Col.Kinds[Row]))
+    {
+    case EJson::None:   return FString();
+    case EJson::Object: return TEXT("{...}");
+    case EJson::Array:  return TEXT("[...]");
+    default:            break;
+    }
+
+    const FJsonTreeNode& Node = Store->GetNode(Col.Nodes[Row]);
+    if (MaxChars <= 0)
+    {
+        return Store->GetValueString(Node);
+    }
+    int64 HiddenBytes = 0;
+    FString Text = Store->GetValueString(Node, MaxChars, HiddenBytes);
+    if (HiddenBytes > 0)
+    {
+        Text += TEXT("\u2026");
+    }
+    return Text;
+}
+
+bool FJsonTreeTable::SortRows(int32 Column, bool bDescending, TArray<int32>& OutOrder) const
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeTable::SortRows");
+    const FColumn& Col = Columns[Column];
+    if (Col.Type == EJsonTreeColumnType::Mixed)
+    {
+        return false;
+    }
+
+    TArray<uint64> Keys;
+    TArray<int32> Rest;
+    OutOrder.Reset();
+    GetSortKeys(Col, bDescending, Keys, OutOrder, Rest);
+    if (Keys.Num() > 1)
+    {
+        RadixSort(Keys, OutOrder);
+    }
+    OutOrder.Append(Rest);
+    return true;
+}
+
+void FJsonTreeTable::GetSortKeys(const FColumn& Column, bool bDescending, TArray<uint64>& OutKeys, TArray<int32>& OutRows, TArray<int32>& OutRest) const
+{
+    const int32 Num = Rows.Num();
+    OutKeys.Reserve(Column.NumValues);
+    OutRows.Reserve(Num);
+    OutRest.Reserve(Num - Column.NumValues);
+
+    // Descending order sorts the complemented keys, which keeps ties in document order
+    const uint64 Flip = bDescending ? MAX_uint64 : 0;
+    const TArray<uint32>* Ranks = Column.Type == EJsonTreeColumnType::String ? &GetStringRanks() : nullptr;
+    for (int32 Row = 0; Row < Num; ++Row)
+    {
+        uint64 Key = 0;
+        bool bValue = true;
+        switch (Column.Type)
+        {
+        case EJsonTreeColumnType::Boolean:
+            bValue = Column.Kinds[Row] == uint8(EJson::Boolean);
+            Key = Column.Booleans[Row] ? 1 : 0;
+            break;
+        case EJsonTreeColumnType::Integer:
+            bValue = Column.Kinds[Row] == uint8(EJson::Number);
+            Key = uint64(Column.Integers[Row]) ^ (uint64(1) << 63);
+            break;
+        case EJsonTreeColumnType::Number:
+            bValue = Column.Kinds[Row] == uint8(EJson::Number);
+            Key = GetNumberKey(Column.Numbers[Row]);
+            break;
+        case EJsonTreeColumnType::String:
+            bValue = Column.Kinds[Row] == uint8(EJson::String);
+            Key = (*Ranks)[Column.Strings[Row]];
+            break;
+        default:
+            bValue = false;
+            break;
+        }
+
+        if (bValue)
+        {
+            OutKeys.Add(Key ^ Flip);
+            OutRows.Add(Row);
+        }
+        else
+        {
+            OutRest.Add(Row);
+        }
+    }
+}
+
+const TArray<uint32>& FJsonTreeTable::GetStringRanks() const
+{
+    if (StringRanks.Num() == DistinctStrings.Num())
+    {
+        return StringRanks;
+    }
+
+    TArray<uint32> Order;
+    Order.SetNumUninitialized(DistinctStrings.Num());
+    for (int32 Id = 0; Id < Order.Num(); ++Id)
+    {
+        Order[Id] = uint32(Id);
+    }
+    Order.Sort([this](uint32 A, uint32 B)
+    {
+        const FUtf8StringView ValueA = Store->GetValue(Store->GetNode(DistinctStrings[A]));
+        const FUtf8StringView ValueB = Store->GetValue(Store->GetNode(DistinctStrings[B]));
+        const int32 Common = FMath::Min(ValueA.Len(), ValueB.Len());
+        const int32 Compare = Common > 0 ? FMemory::Memcmp(ValueA.GetData(), ValueB.GetData(), Common) : 0;
+        return Compare != 0 ? Compare < 0 : ValueA.Len() < ValueB.Len();
+    });
+
+    StringRanks.SetNumUninitialized(Order.Num());
+    for (int32 Rank = 0; Rank < Order.Num(); ++Rank)
+    {
+        StringRanks[Order[Rank]] = uint32(Rank);
+    }
+    return StringRanks;
+}
+
+bool FJsonTreeTable::Summarize(int32 Column, FJsonTreeColumnSummary& OutSummary) const
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeTable::Summarize");
+    const FColumn& Col = Columns[Column];
+    OutSummary = FJsonTreeColumnSummary();
+    OutSummary.Count = Col.NumValues;
+
+    double Sum = 0.0;
+    switch (Col.Type)
+    {
+    case EJsonTreeColumnType::Number:
+        SummarizeNumbers(Col.Numbers.GetData(), Col.Numbers.Num(), OutSummary.Min, OutSummary.Max, Sum);
+        break;
+
+    case EJsonTreeColumnType::Integer:
+    {
+        int64 Min = 0;
+        int64 Max = 0;
+        SummarizeIntegers(Col.Integers.GetData(), Col.Kinds.GetData(), Col.Integers.Num(), Min, Max, Sum);
+        OutSummary.Min = double(Min);
+        OutSummary.Max = double(Max);
+        break;
+    }
+
+    case EJsonTreeColumnType::Boolean:
+    {
+        // Rows without a value hold false, so counting the true ones needs no mask
+        int32 NumTrue = 0;
+        for (const bool bValue : Col.Booleans)
+        {
+            NumTrue += bValue ? 1 : 0;
+        }
+        OutSummary.Min = NumTrue == Col.NumValues ? 1.0 : 0.0;
+        OutSummary.Max = NumTrue > 0 ? 1.0 : 0.0;
+        Sum = double(NumTrue);
+        break;
+    }
+
+    default:
+        return false;
+    }
+
+    if (Col.NumValues == 0)
+    {
+        OutSummary = FJsonTreeColumnSummary();
+        return true;
+    }
+    OutSummary.Mean = Sum / double(Col.NumValues);
+    return true;
+}
+
+SIZE_T FJsonTreeTable::GetAllocatedSize() const
+{
+    SIZE_T Size = Rows.GetAllocatedSize() + Columns.GetAllocatedSize() + DistinctStrings.GetAllocatedSize() + StringRanks.GetAllocatedSize();
+    for (const FColumn& Column : Columns)
+    {
+        Size += Column.Name.GetAllocatedSize() + Column.Kinds.GetAllocatedSize() + Column.Nodes.GetAllocatedSize() + Column.Numbers.GetAllocatedSize()
+            + Column.Integers.GetAllocatedSize() + Column.Booleans.GetAllocatedSize() + Column.Strings.GetAllocatedSize();
+    }
+    return Size;
+}
@@ -0,0 +1,63 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include "JsonTreeTableView.h"
+#include "JsonTreeViewerStats.h"
+
+FJsonTreeTableView::FJsonTreeTableView(const TSharedRef<FJsonTreeTable>& InTable)
+    : Table(InTable)
+{
+    RowIds.SetNumUninitialized(Table->NumRows());
+    for (int32 Row = 0; Row < RowIds.Num(); ++Row)
+    {
+        RowIds[Row] = Row;
+    }
+    Sort(INDEX_NONE, false);
+}
+
+bool FJsonTreeTableView::Sort(int32 Column, bool bDescending)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeTableView::Sort");
+    TArray<int32> Order;
+    if (Column != INDEX_NONE && !Table->SortRows(Column, bDescending, Order))
+    {
+        return false;
+    }
+    SortColumn = Column;
+    bSortDescending = bDescending;
+
+    Items.SetNumUninitialized(RowIds.Num());
+    for (int32 Index = 0; Index < Items.Num(); ++Index)
+    {
+        Items[Index] = &RowIds[Column == INDEX_NONE ? Index : Order[Index]];
+    }
+    return true;
+}
+
+SIZE_T FJsonTreeTableView::GetAllocatedSize() const
+{
+    return Table->GetAllocatedSize() + RowIds.GetAllocatedSize() + Items.GetAllocatedSize();
+}
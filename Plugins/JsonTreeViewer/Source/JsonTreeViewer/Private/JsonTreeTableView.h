@@ -0,0 +1,69 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JsonTreeTable.h"
+
+/**
+ * FJsonTreeTableView
+ *
+ * A table shown by a widget in place of the tree, and the order its rows are listed in. The list
+ * view's items point at the row numbers, so reordering the items reorders the list.
+ */
+class FJsonTreeTableView
+{
+public:
+    // Lists the rows in document order
+    explicit FJsonTreeTableView(const TSharedRef<FJsonTreeTable>& InTable);
+
+    const FJsonTreeTable& GetTable() const { return *Table; }
+
+    // Items of the list view in display order, each pointing at the number of its row
+    const TArray<const int32*>& GetItems() const { return Items; }
+
+    // List the rows in the order of a column's values, or in document order for INDEX_NONE. Returns
+    // false for a column holding values of several types, leaving the order as it was
+    bool Sort(int32 Column, bool bDescending);
+
+    // Column the rows are sorted by, INDEX_NONE for document order, and in which direction
+    int32 GetSortColumn() const { return SortColumn; }
+    bool IsSortDescending() const { return bSortDescending; }
+
+    // Bytes held by the table and its order, not counting the store
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    TSharedRef<FJsonTreeTable> Table;
+
+    // Row numbers, which the items point to
+    TArray<int32> RowIds;
+    TArray<const int32*> Items;
+
+    int32 SortColumn = INDEX_NONE;
+    bool bSortDescending = false;
+};
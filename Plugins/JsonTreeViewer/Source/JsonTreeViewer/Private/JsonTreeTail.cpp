@@ -0,0 +1,226 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include "JsonTreeTail.h"
+#include "JsonTreeViewerStats.h"
+#include "HAL/FileManager.h"
+
+namespace
+{
+    // Most bytes of a tailed file read in one poll, unless a single line is longer
+    constexpr int64 MaxTailReadBytes = 16 * 1024 * 1024;
+
+    // Longest line parsed as a record; the line buffer never grows much past this
+    constexpr int64 MaxTailLineBytes = 256 * 1024 * 1024;
+}
+
+FJsonTreeTail::FJsonTreeTail(const FString& InFilePath, int32 InMaxRecords)
+    : FilePath(InFilePath)
+    , MaxRecords(FMath::Max(InMaxRecords, 0))
+{
+}
+
+int64 FJsonTreeTail::Poll(bool& bOutRestarted)
+{
+    bOutRestarted = false;
+    if (bReading)
+    {
+        return INDEX_NONE;
+    }
+
+    const int64 FileSize = IFileManager::Get().FileSize(*FilePath);
+    if (FileSize < 0 || FileSize == Offset)
+    {
+        return INDEX_NONE;
+    }
+    if (FileSize < Offset)
+    {
+        UE_LOG(LogTemp, Log, TEXT("%s got shorter, reading it again from the start"), *FilePath);
+        Offset = 0;
+        Line = 0;
+        bSkippingLine = false;
+        bOutRestarted = true;
+    }
+    return FileSize;
+}
+
+TFunction<TSharedRef<FJsonTreeTailBatch>()> FJsonTreeTail::BeginRead(int64 FileSize)
+{
+    bReading = true;
+    return [Path = FilePath, ReadOffset = Offset, FirstLine = Line, Cap = MaxRecords, FileSize, bSkip = bSkippingLine]()
+    {
+        return ReadLines(Path, ReadOffset, FirstLine, Cap, FileSize, bSkip);
+    };
+}
+
+TSharedRef<FJsonTreeTailBatch> FJsonTreeTail::ReadLines(const FString& FilePath, int64 Offset, int32 FirstLine, int32 MaxRecords, int64 FileSize, bool bSkipLine)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeTail::ReadLines");
+    TSharedRef<FJsonTreeTailBatch> Batch = MakeShared<FJsonTreeTailBatch>();
+    Batch->Records.ResetToRecords();
+
+    // The writer still has the file open, so it is shared for writing
+    TArray<uint8> Bytes;
+    int64 LineEnd = INDEX_NONE;
+    if (TUniquePtr<FArchive> Reader = TUniquePtr<FArchive>(IFileManager::Get().CreateFileReader(*FilePath, FILEREAD_AllowWrite)))
+    {
+        Reader->Seek(Offset);
+
+        // Only whole lines are consumed; a partly written last line waits for the next poll
+        while (!bSkipLine && LineEnd == INDEX_NONE && Offset + Bytes.Num() < FileSize)
+        {
+            const int64 ReadStart = Bytes.Num();
+            const int64 ReadSize = FMath::Min(FileSize - Offset - ReadStart, MaxTailReadBytes);
+            Bytes.AddUninitialized(ReadSize);
+            Reader->Serialize(Bytes.GetData() + ReadStart, ReadSize);
+            if (Reader->IsError())
+            {
+                Bytes.Reset();
+                break;
+            }
+            for (int64 Index = Bytes.Num() - 1; Index >= ReadStart; --Index)
+            {
+                if (Bytes[Index] == '\n')
+                {
+                    LineEnd = Index;
+                    break;
+                }
+            }
+
+            // The first line alone fills the buffer; a record that long is skipped rather than held
+            if (LineEnd == INDEX_NONE && Bytes.Num() >= MaxTailLineBytes)
+            {
+                Batch->Error = FString::Printf(TEXT("Line is longer than %d MB and was skipped"), int32(MaxTailLineBytes / (1024 * 1024)));
+                Batch->ErrorLine = FirstLine + 1;
+                Batch->ErrorColumn = 1;
+                bSkipLine = true;
+            }
+        }
+
+        if (bSkipLine)
+        {
+            // Read on to the end of the line a chunk at a time, keeping none of it. If it is still
+            // being written, everything up to the end of the file is consumed and the next read goes on skipping.
+            int64 Skipped = Bytes.Num();
+            while (Offset + Skipped < FileSize)
+            {
+                const int64 ReadSize = FMath::Min(FileSize - Offset - Skipped, MaxTailReadBytes);
+                Bytes.SetNumUninitialized(int32(ReadSize), EAllowShrinking::No);
+                Reader->Serialize(Bytes.GetData(), ReadSize);
+                if (Reader->IsError())
+                {
+                    return Batch;
+                }
+                const int32 NewLine = Bytes.Find(uint8('\n'));
+                if (NewLine != INDEX_NONE)
+                {
+                    Batch->ConsumedBytes = Skipped + NewLine + 1;
+                    Batch->NumLines = 1;
+                    return Batch;
+                }
+                Skipped += ReadSize;
+            }
+            Batch->ConsumedBytes = Skipped;
+            Batch->bInLongLine = true;
+            return Batch;
+        }
+    }
+
+    if (LineEnd == INDEX_NONE)
+    {
+        return Batch;
+    }
+    Batch->ConsumedBytes = LineEnd + 1;
+
+    TArray<TPair<int64, int64>> Lines;
+    for (int64 Start = 0; Start <= LineEnd;)
+    {
+        int64 End = Start;
+        while (Bytes[End] != '\n')
+        {
+            ++End;
+        }
+        Lines.Emplace(Start, End);
+        Start = End + 1;
+    }
+    Batch->NumLines = Lines.Num();
+
+    // When the cap would drop most of the batch anyway, the lines before the kept ones aren't parsed
+    int32 FirstParsed = 0;
+    if (MaxRecords > 0 && Lines.Num() > MaxRecords)
+    {
+        FirstParsed = Lines.Num() - MaxRecords;
+    }
+
+    for (int32 LineIndex = FirstParsed; LineIndex < Lines.Num(); ++LineIndex)
+    {
+        int64 Start = Lines[LineIndex].Key;
+        int64 End = Lines[LineIndex].Value;
+        while (Start < End && FChar::IsWhitespace(TCHAR(Bytes[Start])))
+        {
+            ++Start;
+        }
+        while (End > Start && FChar::IsWhitespace(TCHAR(Bytes[End - 1])))
+        {
+            --End;
+        }
+        if (Start == End)
+        {
+            continue;
+        }
+
+        FString Error;
+        int32 ErrorColumn = 0;
+        if (!Batch->Records.AppendRecord(Bytes.GetData() + Start, End - Start, Error, ErrorColumn) && Batch->Error.IsEmpty())
+        {
+            Batch->Error = MoveTemp(Error);
+            Batch->ErrorLine = FirstLine + LineIndex + 1;
+            Batch->ErrorColumn = ErrorColumn;
+        }
+    }
+    return Batch;
+}
+
+int32 FJsonTreeTail::ApplyBatch(const FJsonTreeTailBatch& Batch, FJsonTreeNodeStore& Store, TArray<const FJsonTreeNode*>& Items, TArray<const FJsonTreeNode*>& OutAppended, FString& OutError)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("FJsonTreeTail::ApplyBatch");
+    bReading = false;
+    Offset += Batch.ConsumedBytes;
+    Line += Batch.NumLines;
+    bSkippingLine = Batch.bInLongLine;
+
+    Store.AppendRecords(Batch.Records, OutAppended, OutError);
+    Items.Append(OutAppended);
+
+    int32 NumDropped = 0;
+    if (MaxRecords > 0 && Items.Num() > MaxRecords)
+    {
+        NumDropped = Items.Num() - MaxRecords;
+        Store.RemoveFirstRecords(NumDropped);
+        Items.RemoveAt(0, NumDropped, EAllowShrinking::No);
+    }
+    return NumDropped;
+}
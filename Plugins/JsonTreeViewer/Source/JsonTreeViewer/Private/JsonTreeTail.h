@@ -0,0 +1,96 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JsonTreeNodeStore.h"
+
+/** Lines read from a tailed file in one poll, parsed into a record store off the game thread */
+struct FJsonTreeTailBatch
+{
+    FJsonTreeNodeStore Records;
+    int64 ConsumedBytes = 0;
+    int32 NumLines = 0;
+    FString Error;
+    int32 ErrorLine = 0;
+    int32 ErrorColumn = 0;
+
+    // Whether the read stopped inside a line too long to parse, whose rest the next read skips
+    bool bInLongLine = false;
+};
+
+/**
+ * FJsonTreeTail
+ *
+ * A file of one JSON record per line followed by a widget: how much of it has been consumed, and
+ * the records it has added to the widget's record store. Only complete lines are read, so a line
+ * that is still being written waits for the next poll.
+ */
+class FJsonTreeTail
+{
+public:
+    // Records kept in the store; 0 keeps all of them
+    FJsonTreeTail(const FString& InFilePath, int32 InMaxRecords);
+
+    const FString& GetFilePath() const { return FilePath; }
+
+    // Bytes of the file consumed so far
+    int64 GetOffset() const { return Offset; }
+
+    // Whether a read started by BeginRead hasn't been applied yet
+    bool IsReading() const { return bReading; }
+
+    // Size of the file if it has bytes that weren't read, INDEX_NONE otherwise. A file that got
+    // shorter was truncated or replaced, so reading starts over and bOutRestarted is set: what was
+    // read from it no longer describes it.
+    int64 Poll(bool& bOutRestarted);
+
+    // Read and parse the complete lines past the consumed bytes, up to FileSize. Marks the read as
+    // under way; the returned function does the work and is safe to call from any thread. A line
+    // longer than 256 MB is read through and skipped, with an error in the batch.
+    TFunction<TSharedRef<FJsonTreeTailBatch>()> BeginRead(int64 FileSize);
+
+    // Add the records of a finished read to a record store and its items, dropping the oldest ones
+    // past the cap. Returns the number dropped. Records whose strings no longer fit in the store are
+    // skipped, with the reason in OutError.
+    int32 ApplyBatch(const FJsonTreeTailBatch& Batch, FJsonTreeNodeStore& Store, TArray<const FJsonTreeNode*>& Items, TArray<const FJsonTreeNode*>& OutAppended, FString& OutError);
+
+private:
+    static TSharedRef<FJsonTreeTailBatch> ReadLines(const FString& FilePath, int64 Offset, int32 FirstLine, int32 MaxRecords, int64 FileSize, bool bSkipLine);
+
+    FString FilePath;
+    int32 MaxRecords;
+
+    // Bytes and lines consumed so far
+    int64 Offset = 0;
+    int32 Line = 0;
+
+    bool bReading = false;
+
+    // Whether the consumed bytes end inside a line that is being skipped for its length
+    bool bSkippingLine = false;
+};
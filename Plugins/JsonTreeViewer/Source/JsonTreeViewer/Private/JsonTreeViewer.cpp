@@ -26,18 +26,36 @@
 // THE SOFTWARE.
 
 #include "JsonTreeViewer.h"
+#include "JsonTreeDocumentCache.h"
+#include "JsonTreeViewerStats.h"
+#include "Misc/CoreDelegates.h"
 
 #define LOCTEXT_NAMESPACE "FJsonTreeViewerModule"
 
+FJsonTreeViewerModule::FJsonTreeViewerModule()
+	: DocumentCache(MakeUnique<FJsonTreeDocumentCache>())
+{
+}
+
+FJsonTreeViewerModule::~FJsonTreeViewerModule() = default;
+
 void FJsonTreeViewerModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&FJsonTreeViewerStats::EndFrame);
 }
 
 void FJsonTreeViewerModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	DocumentCache->Empty();
+}
+
+FJsonTreeViewerModule& FJsonTreeViewerModule::Get()
+{
+	return FModuleManager::LoadModuleChecked<FJsonTreeViewerModule>("JsonTreeViewer");
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,505 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "CoreMinimal.h"
+#include "Algo/Reverse.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProperties.h"
+#include "JsonTreeChildLists.h"
+#include "JsonTreeNodeStore.h"
+#include "JsonTreeSource.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+    // {"items":[0,1,...]} with FanOut elements under a single top-level item
+    TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe> MakeFanOutDocument(int32 FanOut)
+    {
+        FString JsonString = TEXT("{\"items\":[");
+        JsonString.Reserve(FanOut * 8);
+        for (int32 Index = 0; Index < FanOut; ++Index)
+        {
+            if (Index > 0)
+            {
+                JsonString += TEXT(",");
+            }
+            JsonString.AppendInt(Index);
+        }
+        JsonString += TEXT("]}");
+        return FJsonTreeSource::FromString(JsonString);
+    }
+
+    // Children listed under an expanded item, the widget's default MaxShownChildren
+    constexpr int32 BenchShownChildren = 1000;
+
+    // Time what a tree refresh costs per item the way the widget lists children: collapsed items
+    // are asked for the first one, an expanded item builds its list of at most BenchShownChildren
+    // once and copies it on every later refresh
+    void RunChildrenBenchmark(const TArray<FString>& Args)
+    {
+        const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+
+        UE_LOG(LogTemp, Display, TEXT("GetChildren cost per refresh, averaged over %d refreshes, %d children shown"), Iterations, BenchShownChildren);
+        UE_LOG(LogTemp, Display, TEXT("%10s %16s %16s %16s"), TEXT("FanOut"), TEXT("Collapsed (us)"), TEXT("First list (us)"), TEXT("Expanded (us)"));
+
+        for (const int32 FanOut : { 100, 1000, 10000, 100000 })
+        {
+            FJsonTreeNodeStore Store;
+            FString Error;
+            int32 ErrorLine = 0;
+            int32 ErrorColumn = 0;
+            if (!Store.Build(MakeFanOutDocument(FanOut), false, false, [](float) { return true; }, Error, ErrorLine, ErrorColumn))
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Failed to build the benchmark document: %s"), *Error);
+                return;
+            }
+
+            TArray<const FJsonTreeNode*> TopLevelItems;
+            Store.GetTopLevelItems(TopLevelItems);
+            const FJsonTreeNode& Items = *TopLevelItems[0];
+
+            FJsonTreeChildLists ChildLists;
+            TArray<const FJsonTreeNode*> Children;
+            auto TimeRefreshes = [&](TFunctionRef<void()> Refresh)
+            {
+                const double Start = FPlatformTime::Seconds();
+                for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+                {
+                    Children.Reset();
+                    Refresh();
+                }
+                return (FPlatformTime::Seconds() - Start) * 1000000.0 / Iterations;
+            };
+
+            const double CollapsedUs = TimeRefreshes([&]() { Store.GetChildren(Items, Children, 1); });
+            const double FirstListUs = TimeRefreshes([&]()
+            {
+                ChildLists.Forget(Items);
+                ChildLists.GetChildren(Store, Items, nullptr, BenchShownChildren, Children);
+            });
+            const double ExpandedUs = TimeRefreshes([&]() { ChildLists.GetChildren(Store, Items, nullptr, BenchShownChildren, Children); });
+            UE_LOG(LogTemp, Display, TEXT("%10d %16.3f %16.3f %16.3f"), FanOut, CollapsedUs, FirstListUs, ExpandedUs);
+        }
+    }
+
+    FAutoConsoleCommand ChildrenBenchmarkCommand(
+        TEXT("JsonTreeViewer.Bench.Children"),
+        TEXT("Time GetChildren for a collapsed item and for the first and later refreshes of an expanded item of growing fan-out. Usage: JsonTreeViewer.Bench.Children [Iterations]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunChildrenBenchmark));
+
+    // Shapes of the synthetic documents generated by the perf suite
+    enum class EPerfShape : uint8
+    {
+        Deep,       // Records nested 64 objects deep
+        Wide,       // One array of short strings
+        Numeric,    // Rows of integers and doubles
+        Keys,       // Records with repeated member names, plus one name that changes every thousand records
+        Count
+    };
+
+    const TCHAR* const PerfShapeNames[] = { TEXT("Deep"), TEXT("Wide"), TEXT("Numeric"), TEXT("Keys") };
+
+    // Rows on one screen of the tree, and the screens scrolled through per document
+    constexpr int32 PerfScreenRows = 60;
+    constexpr int32 PerfScrollScreens = 100;
+
+    // Documents are measured as many times as fit in PerfRepeatBytes, up to PerfMaxRepeat, so the
+    // times of small ones aren't all timer noise
+    constexpr int64 PerfRepeatBytes = 4 * 1024 * 1024;
+    constexpr int32 PerfMaxRepeat = 100;
+
+    struct FPerfResult
+    {
+        EPerfShape Shape = EPerfShape::Deep;
+        int64 Bytes = 0;
+        int32 Nodes = 0;
+        int32 Repeat = 1;
+        double ReadMs = 0.0;             // Map the file and touch every page
+        double ValidateMs = 0.0;         // Lazy build: the whole document is checked, only the top level built
+        double ParseMs = 0.0;            // Eager build on the calling thread
+        double ParallelParseMs = 0.0;    // Eager build with the top level split across worker threads
+        double TreeBuildMs = 0.0;        // Top-level items and their expander check, as the first tree refresh asks for them
+        double FirstScreenRowsMs = 0.0;  // Text and expander check of the first screen's rows, all containers expanded
+        double ScrollScreenRowsMs = 0.0; // The same for each further screen, averaged; neither includes Slate's layout or paint
+        int64 StoreBytes = 0;
+
+        // Physical memory the process gained while measuring the document, in use at the end with its
+        // store still alive, and how far it raised the process peak, zero when an earlier one was higher
+        int64 UsedPhysicalDeltaBytes = 0;
+        int64 PeakUsedPhysicalDeltaBytes = 0;
+    };
+
+    // Name and value of every column of a result, in output order
+    void VisitPerfColumns(const FPerfResult& Result, TFunctionRef<void(const TCHAR*, double)> Visit)
+    {
+        Visit(TEXT("Bytes"), double(Result.Bytes));
+        Visit(TEXT("Nodes"), double(Result.Nodes));
+        Visit(TEXT("Repeat"), double(Result.Repeat));
+        Visit(TEXT("ReadMs"), Result.ReadMs);
+        Visit(TEXT("ValidateMs"), Result.ValidateMs);
+        Visit(TEXT("ParseMs"), Result.ParseMs);
+        Visit(TEXT("ParallelParseMs"), Result.ParallelParseMs);
+        Visit(TEXT("TreeBuildMs"), Result.TreeBuildMs);
+        Visit(TEXT("FirstScreenRowsMs"), Result.FirstScreenRowsMs);
+        Visit(TEXT("ScrollScreenRowsMs"), Result.ScrollScreenRowsMs);
+        Visit(TEXT("StoreBytes"), double(Result.StoreBytes));
+        Visit(TEXT("UsedPhysicalDeltaBytes"), double(Result.UsedPhysicalDeltaBytes));
+        Visit(TEXT("PeakUsedPhysicalDeltaBytes"), double(Result.PeakUsedPhysicalDeltaBytes));
+    }
+
+    // Write a document of about TargetBytes to a file. It is streamed out, so even a gigabyte
+    // document never has to fit in memory as text.
+    bool WritePerfDocument(EPerfShape Shape, int64 TargetBytes, const FString& FilePath)
+    {
+        TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+        if (!Writer)
+        {
+            return false;
+        }
+
+        TArray<ANSICHAR> Buffer;
+        int64 Written = 0;
+        auto Append = [&Buffer](const ANSICHAR* Text)
+        {
+            Buffer.Append(Text, FCStringAnsi::Strlen(Text));
+        };
+        auto Flush = [&Buffer, &Written, &Writer]()
+        {
+            Writer->Serialize(Buffer.GetData(), Buffer.Num());
+            Written += Buffer.Num();
+            Buffer.Reset();
+        };
+
+        TArray<ANSICHAR> DeepOpen;
+        TArray<ANSICHAR> DeepClose;
+        for (int32 Depth = 0; Depth < 64; ++Depth)
+        {
+            DeepOpen.Append("{\"level\":", 9);
+            DeepClose.Add('}');
+        }
+        DeepOpen.Add('\0');
+        DeepClose.Add('\0');
+
+        ANSICHAR Item[256];
+        Append(Shape == EPerfShape::Wide ? "{\"items\":[" : "[");
+        for (int64 Index = 0; Written + Buffer.Num() < TargetBytes; ++Index)
+        {
+            if (Index > 0)
+            {
+                Append(",");
+            }
+
+            switch (Shape)
+            {
+            case EPerfShape::Deep:
+                Append(DeepOpen.GetData());
+                FCStringAnsi::Snprintf(Item, sizeof(Item), "%lld%s", Index, DeepClose.GetData());
+                break;
+            case EPerfShape::Wide:
+                FCStringAnsi::Snprintf(Item, sizeof(Item), "\"item %lld\"", Index);
+                break;
+            case EPerfShape::Numeric:
+                FCStringAnsi::Snprintf(Item, sizeof(Item), "[%lld,%.3f,%lld,%.6e]", Index, double(Index) * 0.25, -7 * Index, double(Index) * 1.5e-3);
+                break;
+            default:
+                FCStringAnsi::Snprintf(Item, sizeof(Item), "{\"id\":%lld,\"name\":\"record %lld\",\"@type\":\"item\",\"transform\":{\"x\":%lld,\"y\":%lld,\"z\":0},\"tag_%lld\":true}",
+                    Index, Index, Index % 100, Index % 37, Index / 1000);
+                break;
+            }
+            Append(Item);
+
+            if (Buffer.Num() >= 1024 * 1024)
+            {
+                Flush();
+            }
+        }
+        Append(Shape == EPerfShape::Wide ? "]}" : "]");
+        Flush();
+        return Writer->Close();
+    }
+
+    // Average milliseconds of Repeat runs of Body
+    template <typename FunctionType>
+    double TimeMs(int32 Repeat, FunctionType&& Body)
+    {
+        const double Start = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < Repeat; ++Iteration)
+        {
+            Body();
+        }
+        return (FPlatformTime::Seconds() - Start) * 1000.0 / Repeat;
+    }
+
+    // The first MaxRows rows of the tree with every container expanded, in display order
+    void CollectPerfRows(const FJsonTreeNodeStore& Store, int32 MaxRows, TArray<const FJsonTreeNode*>& OutRows)
+    {
+        TArray<const FJsonTreeNode*> Pending;
+        Store.GetTopLevelItems(Pending);
+        Algo::Reverse(Pending);
+
+        TArray<const FJsonTreeNode*> Children;
+        while (Pending.Num() > 0 && OutRows.Num() < MaxRows)
+        {
+            const FJsonTreeNode* Node = Pending.Pop();
+            OutRows.Add(Node);
+            Children.Reset();
+            Store.GetChildren(*Node, Children);
+            for (int32 Index = Children.Num() - 1; Index >= 0; --Index)
+            {
+                Pending.Add(Children[Index]);
+            }
+        }
+    }
+
+    // What generating a row asks of the store: its text, and whether its expander arrow shows. The
+    // widgets themselves aren't built, so this is the plugin's share of a frame, not the frame
+    void GeneratePerfRows(const FJsonTreeNodeStore& Store, TArrayView<const FJsonTreeNode* const> Rows)
+    {
+        TArray<const FJsonTreeNode*> Children;
+        for (const FJsonTreeNode* Row : Rows)
+        {
+            const FText Key = FText::FromString(Store.GetKeyString(*Row));
+            const FText Value = FText::FromString(Store.GetValueString(*Row));
+            Children.Reset();
+            Store.GetChildren(*Row, Children, 1);
+        }
+    }
+
+    bool MeasurePerfDocument(const FString& FilePath, FPerfResult& Result)
+    {
+        const FPlatformMemoryStats MemoryBefore = FPlatformMemory::GetStats();
+        FString Error;
+        int32 ErrorLine = 0;
+        int32 ErrorColumn = 0;
+        auto BuildStore = [&](FJsonTreeNodeStore& Store, const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe>& Source, bool bLazy, bool bParallel)
+        {
+            if (!Store.Build(Source, bLazy, bParallel, [](float) { return true; }, Error, ErrorLine, ErrorColumn))
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Failed to build %s: %s (%d:%d)"), *FilePath, *Error, ErrorLine, ErrorColumn);
+                return false;
+            }
+            return true;
+        };
+
+        TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> Source;
+        volatile uint8 Sink = 0;
+        Result.ReadMs = TimeMs(Result.Repeat, [&]()
+        {
+            Source = FJsonTreeSource::FromFile(FilePath);
+            for (int64 Offset = 0; Source.IsValid() && Offset < Source->Num(); Offset += 4096)
+            {
+                Sink = Sink ^ Source->GetData()[Offset];
+            }
+        });
+        if (!Source.IsValid())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Failed to read %s"), *FilePath);
+            return false;
+        }
+        const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe> Document = Source.ToSharedRef();
+
+        bool bBuilt = true;
+        FJsonTreeNodeStore Store;
+        Result.ValidateMs = TimeMs(Result.Repeat, [&]() { bBuilt &= BuildStore(Store, Document, true, false); });
+        Result.ParseMs = TimeMs(Result.Repeat, [&]() { bBuilt &= BuildStore(Store, Document, false, false); });
+        Result.ParallelParseMs = TimeMs(Result.Repeat, [&]() { bBuilt &= BuildStore(Store, Document, false, true); });
+        if (!bBuilt)
+        {
+            return false;
+        }
+        Result.Nodes = Store.Num();
+        Result.StoreBytes = int64(Store.GetAllocatedSize());
+
+        TArray<const FJsonTreeNode*> TopLevelItems;
+        Result.TreeBuildMs = TimeMs(Result.Repeat, [&]()
+        {
+            Store.GetTopLevelItems(TopLevelItems);
+            TArray<const FJsonTreeNode*> Children;
+            for (const FJsonTreeNode* Item : TopLevelItems)
+            {
+                Children.Reset();
+                Store.GetChildren(*Item, Children, 1);
+            }
+        });
+
+        TArray<const FJsonTreeNode*> Rows;
+        Result.FirstScreenRowsMs = TimeMs(Result.Repeat, [&]()
+        {
+            Rows.Reset();
+            CollectPerfRows(Store, PerfScreenRows, Rows);
+            GeneratePerfRows(Store, Rows);
+        });
+
+        Rows.Reset();
+        CollectPerfRows(Store, PerfScreenRows * PerfScrollScreens, Rows);
+        const int32 NumScreens = FMath::Max(1, Rows.Num() / PerfScreenRows);
+        Result.ScrollScreenRowsMs = TimeMs(NumScreens, [&, Screen = 0]() mutable
+        {
+            const int32 First = Screen++ * PerfScreenRows;
+            GeneratePerfRows(Store, TArrayView<const FJsonTreeNode* const>(Rows).Slice(First, FMath::Min(PerfScreenRows, Rows.Num() - First)));
+        });
+
+        const FPlatformMemoryStats MemoryAfter = FPlatformMemory::GetStats();
+        Result.UsedPhysicalDeltaBytes = int64(MemoryAfter.UsedPhysical) - int64(MemoryBefore.UsedPhysical);
+        Result.PeakUsedPhysicalDeltaBytes = int64(MemoryAfter.PeakUsedPhysical) - int64(MemoryBefore.PeakUsedPhysical);
+        return true;
+    }
+
+    void WritePerfResults(const TArray<FPerfResult>& Results)
+    {
+        FString Csv = TEXT("Shape");
+        if (Results.Num() > 0)
+        {
+            VisitPerfColumns(Results[0], [&Csv](const TCHAR* Name, double) { Csv += TEXT(","); Csv += Name; });
+        }
+        Csv += TEXT("\n");
+
+        TArray<TSharedPtr<FJsonValue>> JsonResults;
+        for (const FPerfResult& Result : Results)
+        {
+            const TCHAR* ShapeName = PerfShapeNames[int32(Result.Shape)];
+            TSharedRef<FJsonObject> JsonResult = MakeShared<FJsonObject>();
+            JsonResult->SetStringField(TEXT("Shape"), ShapeName);
+            Csv += ShapeName;
+            VisitPerfColumns(Result, [&Csv, &JsonResult](const TCHAR* Name, double Value)
+            {
+                Csv += FString::Printf(TEXT(",%.17g"), Value);
+                JsonResult->SetNumberField(Name, Value);
+            });
+            Csv += TEXT("\n");
+            JsonResults.Add(MakeShared<FJsonValueObject>(JsonResult));
+        }
+
+        TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+        Root->SetStringField(TEXT("Platform"), FPlatformProperties::IniPlatformName());
+        Root->SetNumberField(TEXT("NumCores"), FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+        Root->SetArrayField(TEXT("Results"), JsonResults);
+        FString Json;
+        FJsonSerializer::Serialize(Root, TJsonWriterFactory<>::Create(&Json));
+
+        const FString BasePath = FPaths::ProfilingDir() / TEXT("JsonTreeViewer") / FString::Printf(TEXT("Perf-%s"), *FDateTime::Now().ToString());
+        FFileHelper::SaveStringToFile(Csv, *(BasePath + TEXT(".csv")));
+        FFileHelper::SaveStringToFile(Json, *(BasePath + TEXT(".json")));
+        UE_LOG(LogTemp, Display, TEXT("Wrote %s.csv and %s.json"), *BasePath, *BasePath);
+    }
+
+    // "64MB", "512KB", "1GB" or a plain byte count
+    int64 ParsePerfSize(const FString& Text)
+    {
+        int64 Scale = 1;
+        FString Number = Text;
+        if (Text.EndsWith(TEXT("KB")))
+        {
+            Scale = 1024;
+        }
+        else if (Text.EndsWith(TEXT("MB")))
+        {
+            Scale = 1024 * 1024;
+        }
+        else if (Text.EndsWith(TEXT("GB")))
+        {
+            Scale = 1024 * 1024 * 1024;
+        }
+        if (Scale > 1)
+        {
+            Number.LeftChopInline(2);
+        }
+        return FCString::Atoi64(*Number) * Scale;
+    }
+
+    // Generate documents of every shape from 1 KB up to MaxSize in steps of 16x, measure each
+    // stage of showing them and write the results where CI can pick them up
+    void RunPerfSuite(const TArray<FString>& Args)
+    {
+        const int64 MaxSize = Args.Num() > 0 ? FMath::Max<int64>(ParsePerfSize(Args[0]), 1024) : 64 * 1024 * 1024;
+
+        TArray<EPerfShape> Shapes;
+        for (int32 Arg = 1; Arg < Args.Num(); ++Arg)
+        {
+            for (int32 Shape = 0; Shape < int32(EPerfShape::Count); ++Shape)
+            {
+                if (Args[Arg].Equals(PerfShapeNames[Shape], ESearchCase::IgnoreCase))
+                {
+                    Shapes.AddUnique(EPerfShape(Shape));
+                }
+            }
+        }
+        if (Shapes.Num() == 0)
+        {
+            for (int32 Shape = 0; Shape < int32(EPerfShape::Count); ++Shape)
+            {
+                Shapes.Add(EPerfShape(Shape));
+            }
+        }
+
+        const FString FilePath = FPaths::ProjectIntermediateDir() / TEXT("JsonTreeViewer") / TEXT("PerfDocument.json");
+        UE_LOG(LogTemp, Display, TEXT("%-8s %12s %10s %9s %9s %9s %9s %9s %9s %9s %10s"), TEXT("Shape"), TEXT("Bytes"), TEXT("Nodes"),
+            TEXT("Read"), TEXT("Validate"), TEXT("Parse"), TEXT("Parallel"), TEXT("Tree"), TEXT("1st rows"), TEXT("Scr rows"), TEXT("Store MB"));
+
+        TArray<FPerfResult> Results;
+        for (const EPerfShape Shape : Shapes)
+        {
+            for (int64 Size = 1024; Size <= MaxSize; Size *= 16)
+            {
+                if (!WritePerfDocument(Shape, Size, FilePath))
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("Failed to write %s"), *FilePath);
+                    return;
+                }
+
+                FPerfResult Result;
+                Result.Shape = Shape;
+                Result.Bytes = IFileManager::Get().FileSize(*FilePath);
+                Result.Repeat = int32(FMath::Clamp<int64>(PerfRepeatBytes / Result.Bytes, 1, PerfMaxRepeat));
+                if (MeasurePerfDocument(FilePath, Result))
+                {
+                    UE_LOG(LogTemp, Display, TEXT("%-8s %12lld %10d %9.2f %9.2f %9.2f %9.2f %9.3f %9.3f %9.3f %10.1f"), PerfShapeNames[int32(Shape)], Result.Bytes, Result.Nodes,
+                        Result.ReadMs, Result.ValidateMs, Result.ParseMs, Result.ParallelParseMs, Result.TreeBuildMs, Result.FirstScreenRowsMs, Result.ScrollScreenRowsMs,
+                        double(Result.StoreBytes) / (1024.0 * 1024.0));
+                    Results.Add(Result);
+                }
+            }
+        }
+        IFileManager::Get().Delete(*FilePath);
+
+        WritePerfResults(Results);
+    }
+
+    FAutoConsoleCommand PerfSuiteCommand(
+        TEXT("JsonTreeViewer.Perf.Run"),
+        TEXT("Time reading, validating, parsing, the first tree refresh and the rows of the first and later screens for generated documents of growing size, ")
+        TEXT("and write CSV/JSON results to the profiling directory. Usage: JsonTreeViewer.Perf.Run [MaxSize, e.g. 64MB or 1GB] [Deep|Wide|Numeric|Keys ...]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunPerfSuite));
+}
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,119 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "JsonTreeViewerStats.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "Stats/Stats.h"
+#include <atomic>
+
+DECLARE_STATS_GROUP(TEXT("JsonTreeViewer"), STATGROUP_JsonTreeViewer, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Nodes"), STAT_JsonTreeViewer_Nodes, STATGROUP_JsonTreeViewer);
+DECLARE_MEMORY_STAT(TEXT("String Pool"), STAT_JsonTreeViewer_StringBytes, STATGROUP_JsonTreeViewer);
+DECLARE_MEMORY_STAT(TEXT("Node Arena"), STAT_JsonTreeViewer_ArenaBytes, STATGROUP_JsonTreeViewer);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rows Generated"), STAT_JsonTreeViewer_RowsGenerated, STATGROUP_JsonTreeViewer);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GetChildren Calls"), STAT_JsonTreeViewer_GetChildrenCalls, STATGROUP_JsonTreeViewer);
+
+TRACE_DECLARE_INT_COUNTER(JsonTreeViewer_Nodes, TEXT("JsonTreeViewer/Nodes"));
+TRACE_DECLARE_MEMORY_COUNTER(JsonTreeViewer_StringBytes, TEXT("JsonTreeViewer/String Pool"));
+TRACE_DECLARE_MEMORY_COUNTER(JsonTreeViewer_ArenaBytes, TEXT("JsonTreeViewer/Node Arena"));
+TRACE_DECLARE_INT_COUNTER(JsonTreeViewer_RowsGenerated, TEXT("JsonTreeViewer/Rows Generated"));
+TRACE_DECLARE_INT_COUNTER(JsonTreeViewer_GetChildrenCalls, TEXT("JsonTreeViewer/GetChildren Calls"));
+
+UE_TRACE_CHANNEL_DEFINE(JsonTreeViewerChannel)
+
+namespace
+{
+    void OnProfilingChanged(IConsoleVariable* Variable);
+
+    TAutoConsoleVariable<bool> CVarProfiling(
+        TEXT("JsonTreeViewer.Profiling"),
+        false,
+        TEXT("Send the JSON Tree Viewer's CPU scopes and counters to Unreal Insights. Turning it on also enables the cpu channel they need."),
+        FConsoleVariableDelegate::CreateStatic(&OnProfilingChanged));
+
+    void OnProfilingChanged(IConsoleVariable* Variable)
+    {
+#if UE_TRACE_ENABLED
+        // Other systems may want cpu scopes too, so only the plugin's own channel is turned off again
+        const bool bEnabled = Variable->GetBool();
+        if (bEnabled)
+        {
+            UE::Trace::ToggleChannel(TEXT("Cpu"), true);
+        }
+        UE::Trace::ToggleChannel(TEXT("JsonTreeViewer"), bEnabled);
+#endif
+    }
+
+    // Totals are kept here rather than in the stats, as stores are built on worker threads and
+    // Insights counters aren't thread-safe
+    std::atomic<int64> NumNodes(0);
+    std::atomic<int64> NumStringBytes(0);
+    std::atomic<int64> NumArenaBytes(0);
+
+    // Counted on the game thread
+    int32 NumRowsGenerated = 0;
+    int32 NumGetChildrenCalls = 0;
+}
+
+void FJsonTreeViewerStats::AddStoreMemory(int64 Nodes, int64 StringBytes, int64 ArenaBytes)
+{
+    NumNodes += Nodes;
+    NumStringBytes += StringBytes;
+    NumArenaBytes += ArenaBytes;
+}
+
+void FJsonTreeViewerStats::AddRowGenerated()
+{
+    INC_DWORD_STAT(STAT_JsonTreeViewer_RowsGenerated);
+    ++NumRowsGenerated;
+}
+
+void FJsonTreeViewerStats::AddGetChildrenCall()
+{
+    INC_DWORD_STAT(STAT_JsonTreeViewer_GetChildrenCalls);
+    ++NumGetChildrenCalls;
+}
+
+void FJsonTreeViewerStats::EndFrame()
+{
+    SET_DWORD_STAT(STAT_JsonTreeViewer_Nodes, NumNodes.load());
+    SET_MEMORY_STAT(STAT_JsonTreeViewer_StringBytes, NumStringBytes.load());
+    SET_MEMORY_STAT(STAT_JsonTreeViewer_ArenaBytes, NumArenaBytes.load());
+
+    if (CVarProfiling.GetValueOnGameThread())
+    {
+        TRACE_COUNTER_SET(JsonTreeViewer_Nodes, NumNodes.load());
+        TRACE_COUNTER_SET(JsonTreeViewer_StringBytes, NumStringBytes.load());
+        TRACE_COUNTER_SET(JsonTreeViewer_ArenaBytes, NumArenaBytes.load());
+        TRACE_COUNTER_SET(JsonTreeViewer_RowsGenerated, NumRowsGenerated);
+        TRACE_COUNTER_SET(JsonTreeViewer_GetChildrenCalls, NumGetChildrenCalls);
+    }
+    NumRowsGenerated = 0;
+    NumGetChildrenCalls = 0;
+}
@@ -0,0 +1,60 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+// Trace channel of the plugin's CPU scopes; off until JsonTreeViewer.Profiling is set
+UE_TRACE_CHANNEL_EXTERN(JsonTreeViewerChannel)
+
+// Time the rest of the enclosing scope in Unreal Insights while the channel is on
+#define JSONTREEVIEWER_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, JsonTreeViewerChannel)
+
+/**
+ * FJsonTreeViewerStats
+ *
+ * Counters of the STATGROUP_JsonTreeViewer stat group (`stat JsonTreeViewer`), which are also
+ * published to Unreal Insights once a frame while JsonTreeViewer.Profiling is on. Stats are
+ * compiled out of Test and Shipping builds and Insights counters out of Shipping, so both cost
+ * nothing there. The store counters can be changed from any thread.
+ */
+class FJsonTreeViewerStats
+{
+public:
+    // Change in the nodes, string pool bytes and node block bytes held by all node stores
+    static void AddStoreMemory(int64 Nodes, int64 StringBytes, int64 ArenaBytes);
+
+    // Per-frame counts of tree rows generated and of GetChildren calls by tree views
+    static void AddRowGenerated();
+    static void AddGetChildrenCall();
+
+    // Publish this frame's counters to Insights and start counting the next frame's
+    static void EndFrame();
+};
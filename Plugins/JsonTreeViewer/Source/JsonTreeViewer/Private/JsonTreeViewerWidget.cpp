@@ -26,10 +26,274 @@
 // THE SOFTWARE.
 
 #include "JsonTreeViewerWidget.h"
+#include "JsonTreeChildLists.h"
+#include "JsonTreeDocumentCache.h"
+#include "JsonTreeExpansion.h"
+#include "JsonTreeFilterView.h"
+#include "JsonTreeLocation.h"
+#include "JsonTreeSearch.h"
+#include "JsonTreeSearchIndex.h"
+#include "JsonTreeTableView.h"
+#include "JsonTreeTail.h"
+#include "JsonTreeViewer.h"
+#include "JsonTreeViewerStats.h"
+#include "JsonTreeSource.h"
+#include "SJsonTreeRow.h"
+#include "SJsonTreeTableRow.h"
 #include "Serialization/JsonSerializer.h" 
 #include "Dom/JsonObject.h" 
 #include "Logging/LogMacros.h" 
 #include "Styling/CoreStyle.h"
+#include "Async/Async.h"
+#include "Widgets/Input/SSearchBox.h"
+
+namespace
+{
+    // Rows whose text is cached; the cache starts over once it grows past this
+    constexpr int32 MaxCachedRowTexts = 4096;
+
+    // Search matches whose paths are expanded as soon as a search finishes
+    constexpr int32 MaxRevealedSearchResults = 256;
+
+    // Items of the table's list view while no table is shown
+    const TArray<const int32*> NoTableRows;
+
+    // Approximate bytes held by a parsed JSON value and everything below it
+    SIZE_T GetJsonValueSize(const TSharedPtr<FJsonValue>& JsonValue)
+    {
+        // Every value is a shared pointer with its own reference count block
+        static constexpr SIZE_T SharedPtrOverhead = 2 * sizeof(void*) + 2 * sizeof(int32);
+
+        SIZE_T Size = SharedPtrOverhead;
+        switch (JsonValue->Type)
+        {
+        case EJson::Object:
+        {
+            const TSharedPtr<FJsonObject>& Object = JsonValue->AsObject();
+            Size += sizeof(FJsonValueObject) + SharedPtrOverhead + sizeof(FJsonObject) + Object->Values.GetAllocatedSize();
+            for (const auto& Pair : Object->Values)
+            {
+                Size += Pair.Key.GetAllocatedSize() + GetJsonValueSize(Pair.Value);
+            }
+            break;
+        }
+        case EJson::Array:
+        {
+            const TArray<TSharedPtr<FJsonValue>>& Elements = JsonValue->AsArray();
+            Size += sizeof(FJsonValueArray) + Elements.GetAllocatedSize();
+            for (const TSharedPtr<FJsonValue>& Element : Elements)
+            {
+                Size += GetJsonValueSize(Element);
+            }
+            break;
+        }
+        case EJson::String:
+        {
+            FString String;
+            JsonValue->TryGetString(String);
+            Size += sizeof(FJsonValueString) + String.GetAllocatedSize();
+            break;
+        }
+        case EJson::Number:  Size += sizeof(FJsonValueNumber); break;
+        case EJson::Boolean: Size += sizeof(FJsonValueBoolean); break;
+        default:             Size += sizeof(FJsonValueNull); break;
+        }
+        return Size;
+    }
+
+    // Node store filter for a filter set from Blueprints; a number bound only leaves numbers
+    FJsonTreeNodeFilter MakeNodeFilter(const FJsonTreeFilter& Filter)
+    {
+        FJsonTreeNodeFilter NodeFilter;
+        switch (Filter.Type)
+        {
+        case EJsonTreeFilterType::Null:    NodeFilter.TypeMask = 1u << uint32(EJson::Null); break;
+        case EJsonTreeFilterType::Boolean: NodeFilter.TypeMask = 1u << uint32(EJson::Boolean); break;
+        case EJsonTreeFilterType::Number:  NodeFilter.TypeMask = 1u << uint32(EJson::Number); break;
+        case EJsonTreeFilterType::String:  NodeFilter.TypeMask = 1u << uint32(EJson::String); break;
+        case EJsonTreeFilterType::Object:  NodeFilter.TypeMask = 1u << uint32(EJson::Object); break;
+        case EJsonTreeFilterType::Array:   NodeFilter.TypeMask = 1u << uint32(EJson::Array); break;
+        default:                           break;
+        }
+        NodeFilter.KeyPattern = Filter.KeyPattern;
+
+        NodeFilter.bNumberRange = Filter.bUseMinNumber || Filter.bUseMaxNumber;
+        NodeFilter.MinNumber = Filter.bUseMinNumber ? Filter.MinNumber : TNumericLimits<double>::Lowest();
+        NodeFilter.MaxNumber = Filter.bUseMaxNumber ? Filter.MaxNumber : TNumericLimits<double>::Max();
+        return NodeFilter;
+    }
+}
+
+/** Input of the tree on show and the settings it was loaded with, which a rebuild compares against */
+struct FJsonTreeLoadedInput
+{
+    FJsonTreeDocumentKey Key;
+    FJsonTreeLoadOptions Options;
+
+    // Whether loading this input with these settings would give the same tree; caching, snapshots
+    // and parallel builds only change how it is built
+    bool Matches(const FJsonTreeDocumentKey& OtherKey, const FJsonTreeLoadOptions& OtherOptions) const
+    {
+        return Key == OtherKey && Options.bLazyChildren == OtherOptions.bLazyChildren
+            && Options.bBuildSearchIndex == OtherOptions.bBuildSearchIndex && Options.RetainSource == OtherOptions.RetainSource;
+    }
+};
+
+/**
+ * Everything a load produces. It is filled on whichever thread runs the load and then
+ * handed to the widget in one go; only a time-sliced load shows its tree while it grows.
+ */
+struct FJsonTreeLoadResult
+{
+    bool bFromFile = false;
+    FString JsonFilePath;
+    FString JsonString;
+    TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> Source;
+    TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> SearchSource;
+    TArray<const FJsonTreeNode*> TreeItems;
+    FJsonTreeLoadStats Stats;
+    FString Error;
+    int32 ErrorLine = 0;
+    int32 ErrorColumn = 0;
+
+    // Where the document goes in the document cache, and whether it came from there
+    bool bCacheable = false;
+    bool bCacheHit = false;
+    FJsonTreeDocumentKey CacheKey;
+
+    // Input loaded by InitJsonTree or InitJsonTreeAsync; null for streams and SetDocument
+    TSharedPtr<FJsonTreeLoadedInput> Input;
+
+    // Tree of the widget's own, which it may change; null when the result shows a document
+    TSharedPtr<FJsonTreeNodeStore> NodeStore;
+
+    // Document shown when other widgets may show it too: cached, or passed to SetDocument
+    TSharedPtr<FJsonTreeDocument> Document;
+    TSharedPtr<FJsonTreeSearchIndex, ESPMode::ThreadSafe> SearchIndex;
+};
+
+namespace
+{
+    // Fill in a result that shows an already loaded document
+    void FillFromDocument(const TSharedRef<FJsonTreeDocument>& Document, const FJsonTreeLoadOptions& Options, FJsonTreeLoadResult& OutResult)
+    {
+        OutResult.Document = Document;
+        OutResult.Source = Document->GetSource();
+        if (Options.bBuildSearchIndex)
+        {
+            OutResult.SearchIndex = Document->GetSearchIndex();
+            OutResult.SearchSource = Document->GetSearchSource();
+        }
+        OutResult.JsonFilePath = Document->GetFilePath();
+        OutResult.bFromFile = !OutResult.JsonFilePath.IsEmpty();
+
+        const double BuildStart = FPlatformTime::Seconds();
+        Document->GetNodeStore()->GetTopLevelItems(OutResult.TreeItems);
+        OutResult.Stats.Bytes = Document->GetLoadStats().Bytes;
+        OutResult.Stats.Nodes = Document->GetNodeStore()->Num();
+        OutResult.Stats.BuildMs = (FPlatformTime::Seconds() - BuildStart) * 1000.0;
+    }
+
+    // Fill in the result of a load that has just built Document from the input, to go into the document cache
+    void FillFromLoadedDocument(const FString& JsonPathOrString, const FJsonTreeLoadOptions& Options, const TSharedRef<FJsonTreeDocument>& Document, FJsonTreeLoadResult& OutResult)
+    {
+        FillFromDocument(Document, Options, OutResult);
+        OutResult.Stats.ReadMs = Document->GetLoadStats().ReadMs;
+        OutResult.Stats.ParseMs = Document->GetLoadStats().ParseMs;
+        OutResult.Stats.bFromSnapshot = Document->GetLoadStats().bFromSnapshot;
+        if (!OutResult.bFromFile)
+        {
+            OutResult.JsonString = JsonPathOrString;
+        }
+    }
+
+    // Fill in the result of a load that has just built a tree of the widget's own from the input
+    void FillFromLoadedTree(const FString& JsonPathOrString, const FJsonTreeLoadOptions& Options, FJsonTreeDocument::FLoadedTree& Tree, FJsonTreeLoadResult& OutResult)
+    {
+        OutResult.NodeStore = MoveTemp(Tree.NodeStore);
+        if (Options.RetainSource != EJsonTreeRetainSource::None)
+        {
+            OutResult.Source = Tree.Source;
+        }
+        if (Options.bBuildSearchIndex)
+        {
+            OutResult.SearchSource = Tree.Source;
+        }
+        OutResult.JsonFilePath = MoveTemp(Tree.FilePath);
+        OutResult.bFromFile = !OutResult.JsonFilePath.IsEmpty();
+        if (!OutResult.bFromFile)
+        {
+            OutResult.JsonString = JsonPathOrString;
+        }
+
+        const double BuildStart = FPlatformTime::Seconds();
+        OutResult.NodeStore->GetTopLevelItems(OutResult.TreeItems);
+        OutResult.Stats = Tree.Stats;
+        OutResult.Stats.BuildMs = (FPlatformTime::Seconds() - BuildStart) * 1000.0;
+    }
+
+    // Look the input up in the document cache. A hit fills in the result as a load would; a miss
+    // leaves the key in it, so the document is cached once it has been loaded. Either way the result
+    // records the input, so rebuilds can tell it is still on show.
+    bool LoadCachedDocument(const FString& JsonPathOrString, const FJsonTreeLoadOptions& Options, FJsonTreeLoadResult& OutResult)
+    {
+        OutResult.CacheKey = FJsonTreeDocumentKey::Make(JsonPathOrString, Options);
+        OutResult.Input = MakeShared<FJsonTreeLoadedInput>();
+        OutResult.Input->Key = OutResult.CacheKey;
+        OutResult.Input->Options = Options;
+        if (!Options.bUseDocumentCache)
+        {
+            return false;
+        }
+
+        OutResult.bCacheable = true;
+
+        const TSharedPtr<FJsonTreeDocument> Document = FJsonTreeViewerModule::Get().GetDocumentCache().Find(OutResult.CacheKey);
+        if (!Document.IsValid())
+        {
+            return false;
+        }
+
+        // Indexing needs the text, which a document cached without it can't offer
+        if (Options.bBuildSearchIndex && !Document->GetSearchIndex().IsValid() && !Document->GetSearchSource().IsValid())
+        {
+            return false;
+        }
+
+        FillFromDocument(Document.ToSharedRef(), Options, OutResult);
+        OutResult.bCacheHit = true;
+        if (!OutResult.bFromFile)
+        {
+            OutResult.JsonString = JsonPathOrString;
+        }
+        return true;
+    }
+}
+
+/** A load run on the game thread in slices of TimeSliceBudgetMs, one per frame */
+struct FJsonTreeSlicedLoad
+{
+    FString JsonPathOrString;
+    FJsonTreeLoadOptions Options;
+    FJsonTreeLoadResult Result;
+    TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> Source;
+
+    // Time spent in the slices so far
+    double ParseSeconds = 0.0;
+
+    // Whether the tree is shown while it grows; an incremental update is only patched in once complete
+    bool bShowPartial = false;
+
+    // Whether the text arrives through AppendJsonTreeStream, and whether EndJsonTreeStream has been called
+    bool bStream = false;
+    bool bStreamEnded = false;
+    int64 ExpectedBytes = 0;
+
+    // Tree displayed before the load, put back if it fails or is cancelled
+    TSharedPtr<const FJsonTreeNodeStore> PreviousStore;
+    TSharedPtr<FJsonTreeNodeStore> PreviousOwnedStore;
+    TArray<const FJsonTreeNode*> PreviousItems;
+};
 
 UJsonTreeViewerWidget::UJsonTreeViewerWidget()
 {
@@ -41,32 +305,126 @@ UJsonTreeViewerWidget::UJsonTreeViewerWidget()
     KeyColor = FLinearColor(0.370628f, 0.808f, 0.143016f);              // Pale Green for keys
     KeyAtColor = FLinearColor(0.5f, 0.5f, 1.f);                         // Mauve for keys starting with '@'
     Padding = FMargin(2.f);                                             // Uniform padding around elements
+    RowHeight = 0.f;                                                    // Rows sized to their content
+
+    _bValidJson = false;
+    _LoadErrorLine = 0;
+    _LoadErrorColumn = 0;
+
+    bLazyChildren = true;
+    bParallelBuild = true;
+    RetainSource = EJsonTreeRetainSource::Dom;
+    bLoadAsync = false;
+    bSelectableText = false;
+    bIncrementalUpdate = false;
+    bShareDocuments = true;
+    bUseTreeSnapshots = false;
+    bTimeSlicedLoad = false;
+    TimeSliceBudgetMs = 2.f;
+    MaxExpandedItems = 100000;
+    MaxValueChars = 1000;
+    MaxShownChildren = 1000;
+    _LoadSerial = 0;
+    _bLoading = false;
+    _bDocumentSet = false;
+    _bBuildingFilterTree = false;
+
+    TailPollInterval = 0.25f;
+
+    bShowSearchBox = false;
+    SearchHighlightColor = FLinearColor(1.f, 0.85f, 0.f, 0.35f);         // Translucent amber behind matches
+    _Search = MakeShared<FJsonTreeSearch>();
+    _ChildLists = MakeShared<FJsonTreeChildLists>();
 }
 
 TSharedRef<SWidget> UJsonTreeViewerWidget::RebuildWidget()
 {
-    InitJsonTree(JsonInput);  // Parse the JSON string or file into a tree structure
+    JSONTREEVIEWER_TRACE_SCOPE("UJsonTreeViewerWidget::RebuildWidget");
+    // With incremental updates, or when the document comes back from the document cache, the node
+    // store outlives this rebuild, so the new tree view can start out with the same items expanded
+    FJsonTreeExpansion Expansion;
+    const TSharedPtr<const FJsonTreeNodeStore> NodeStore = _NodeStore;
+    if (_TreeView.IsValid())
+    {
+        Expansion = FJsonTreeExpansion::Save(*_TreeView);
+    }
+
+    // Parse the JSON string or file into a tree structure; a tailed file keeps the records it has,
+    // a document passed to SetDocument stays, and so does a tree loaded from the same input, as long
+    // as the file hasn't changed since
+    if (!IsTailing() && !_bDocumentSet && !IsInputShown())
+    {
+        if (bLoadAsync)
+        {
+            InitJsonTreeAsync(JsonInput);
+        }
+        else
+        {
+            InitJsonTree(JsonInput);
+        }
+    }
     _Widget = SNew(SBox)
         [
             SNew(SVerticalBox)
+                + SVerticalBox::Slot()
+                .AutoHeight()
+                [
+                    SAssignNew(_SearchBox, SSearchBox)
+                        .Visibility(bShowSearchBox ? EVisibility::Visible : EVisibility::Collapsed)
+                        .InitialText(_Search->GetHighlight())
+                        .DelayChangeNotificationsWhileTyping(true)
+                        .OnTextChanged_UObject(this, &UJsonTreeViewerWidget::HandleSearchTextChanged)
+                        .OnTextCommitted_UObject(this, &UJsonTreeViewerWidget::HandleSearchTextCommitted)
+                ]
+                + SVerticalBox::Slot()
+                .FillHeight(1.f)
+                [
+                    // The tree view scrolls itself so it only generates rows for the items in view;
+                    // putting it in a scroll box would give it unbounded height and a row for every item
+                    SAssignNew(_TreeView, STreeView<const FJsonTreeNode*>)
+                        .TreeItemsSource(GetAppliedFilter() ? &GetAppliedFilter()->GetTopLevelItems() : &_TreeItems)
+                        .SelectionMode(ESelectionMode::None)
+                        .OnGenerateRow_UObject(this, &UJsonTreeViewerWidget::GenerateRow)
+                        .OnGetChildren_UObject(this, &UJsonTreeViewerWidget::GetChildren)
+                        .OnExpansionChanged_UObject(this, &UJsonTreeViewerWidget::HandleExpansionChanged)
+                        .OnSetExpansionRecursive_UObject(this, &UJsonTreeViewerWidget::HandleSetExpansionRecursive)
+                        .OnMouseButtonClick_UObject(this, &UJsonTreeViewerWidget::HandleItemClicked)
+                ]
                 + SVerticalBox::Slot()
                 .FillHeight(1.f)
                 [
-                    SNew(SScrollBox)
-                        + SScrollBox::Slot()
-                        [
-                            SAssignNew(_TreeView, STreeView<TSharedPtr<class FTreeItem>>)
-                                .TreeItemsSource(&_TreeItems)
-                                .SelectionMode(ESelectionMode::None)
-                                .OnGenerateRow_UObject(this, &UJsonTreeViewerWidget::GenerateRow)
-                                .OnGetChildren_UObject(this, &UJsonTreeViewerWidget::GetChildren)
-                        ]
+                    SAssignNew(_TableView, SListView<const int32*>)
+                        .ListItemsSource(&NoTableRows)
+                        .SelectionMode(ESelectionMode::None)
+                        .OnGenerateRow_UObject(this, &UJsonTreeViewerWidget::GenerateTableRow)
+                        .HeaderRow(SAssignNew(_TableHeader, SHeaderRow))
                 ]
         ];
+    RefreshTable();
+
+    if (_NodeStore == NodeStore)
+    {
+        Expansion.Restore(*_TreeView);
+    }
 
     return _Widget.ToSharedRef();
 }
 
+void UJsonTreeViewerWidget::SynchronizeProperties()
+{
+    Super::SynchronizeProperties();
+
+    // Use default Slate textbox font if no custom font is provided
+    _RowFont = Font.FontObject ? Font : FSlateFontInfo(FPaths::EngineContentDir() / TEXT("Slate/Fonts/Roboto-Regular.ttf"), 9);
+
+    // Child lists are as long as MaxShownChildren was when they were built
+    _ChildLists->ForgetLists();
+    if (_TreeView.IsValid())
+    {
+        _TreeView->RebuildList();
+    }
+}
+
 void UJsonTreeViewerWidget::ReleaseSlateResources(bool bReleaseChildren)
 {
     Super::ReleaseSlateResources(bReleaseChildren);
@@ -75,6 +433,12 @@ void UJsonTreeViewerWidget::ReleaseSlateResources(bool bReleaseChildren)
     _Widget.Reset();
 }
 
+void UJsonTreeViewerWidget::BeginDestroy()
+{
+    BeginLoad();
+    Super::BeginDestroy();
+}
+
 bool UJsonTreeViewerWidget::ReadJsonFile(const FString& FilePath, FString& JsonString)
 {
     // Read the entire file contents into JsonString; warn if it fails
@@ -88,223 +452,1733 @@ bool UJsonTreeViewerWidget::ReadJsonFile(const FString& FilePath, FString& JsonS
 
 void UJsonTreeViewerWidget::InitJsonTree(const FString JsonPathorString)
 {
-    // Determine if the input is a file path or raw JSON string
-    if (FPaths::FileExists(JsonPathorString))
+    BeginLoad();
+
+    FJsonTreeLoadResult Result;
+    const FJsonTreeLoadOptions Options = GetLoadOptions();
+    if (!LoadCachedDocument(JsonPathorString, Options, Result))
     {
-        JsonInput = JsonPathorString;
-        _JsonFilePath = JsonPathorString;
-        _bValidJson = ReadJsonFile(_JsonFilePath, _JsonString);
+        LoadJsonTree(JsonPathorString, Options, Result, [](float) { return true; });
     }
-    else
-    {
-        UE_LOG(LogTemp, Log, TEXT("This does not look like a valid file path: %s\nChecking if it is a JSON string..."), *JsonPathorString);
+    ApplyLoadResult(Result);
+}
 
-        // Check for valid JSON text
-        if (IsValidJson(JsonPathorString))
-        {
-            JsonInput = JsonPathorString;
-            _JsonString = JsonPathorString;
-            _bValidJson = true;
-            UE_LOG(LogTemp, Log, TEXT("This appears to be a valid JSON string..."));
-        }
-        else
+void UJsonTreeViewerWidget::InitJsonTreeAsync(const FString JsonPathOrString)
+{
+    const uint32 Serial = BeginLoad();
+    TSharedPtr<FThreadSafeBool, ESPMode::ThreadSafe> Cancelled = _LoadCancelled;
+    TWeakObjectPtr<UJsonTreeViewerWidget> WeakThis(this);
+    const FJsonTreeLoadOptions Options = GetLoadOptions();
+    _bLoading = true;
+
+    TSharedRef<FJsonTreeLoadResult> Result = MakeShared<FJsonTreeLoadResult>();
+    if (LoadCachedDocument(JsonPathOrString, Options, *Result))
+    {
+        // Still finish on a later tick, so listeners see events in the same order as for a real load
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, Result]()
         {
-            _bValidJson = false;
-            UE_LOG(LogTemp, Warning, TEXT("This string '%s' is neither a valid file path nor a valid JSON string! Aborting!"), *JsonPathorString);
-        }
+            UJsonTreeViewerWidget* Widget = WeakThis.Get();
+            if (Widget && Widget->_LoadSerial == Serial)
+            {
+                Widget->_bLoading = false;
+                Widget->ApplyLoadResult(*Result);
+            }
+        });
+        return;
+    }
+
+    if (bTimeSlicedLoad)
+    {
+        BeginTimeSlicedLoad(JsonPathOrString, Options, *Result);
+        return;
     }
 
-    // Parse and build the tree if the JSON is valid
-    if (_bValidJson)
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Serial, Cancelled, JsonPathOrString, Options, Result]()
     {
-        if (ParseJsonContents(_JsonString, _JsonValue) && _JsonValue)
+        float LastReported = -1.f;
+
+        const bool bFinished = LoadJsonTree(JsonPathOrString, Options, *Result, [&](float Progress)
+        {
+            // Forward progress in whole percent steps so the game thread isn't flooded with tasks
+            if (Progress - LastReported >= 0.01f)
+            {
+                LastReported = Progress;
+                AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, Progress]()
+                {
+                    UJsonTreeViewerWidget* Widget = WeakThis.Get();
+                    if (Widget && Widget->_LoadSerial == Serial)
+                    {
+                        Widget->OnLoadProgress.Broadcast(Progress);
+                    }
+                });
+            }
+            return !*Cancelled;
+        });
+
+        if (!bFinished || *Cancelled)
         {
-            BuildTree(_JsonValue);
+            return;
         }
+
+        // Publish the finished tree on the game thread, unless a newer load has started meanwhile
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, Result]()
+        {
+            UJsonTreeViewerWidget* Widget = WeakThis.Get();
+            if (Widget && Widget->_LoadSerial == Serial)
+            {
+                Widget->_bLoading = false;
+                Widget->ApplyLoadResult(*Result);
+            }
+        });
+    });
+}
+
+void UJsonTreeViewerWidget::SetDocument(UJsonTreeDocument* Document)
+{
+    if (!Document || !Document->IsLoaded())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("SetDocument needs a document that was loaded successfully"));
+        return;
     }
+    ShowDocument(Document->GetDocument().ToSharedRef());
 }
 
-TSharedRef<ITableRow> UJsonTreeViewerWidget::GenerateRow(TSharedPtr<class FTreeItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
+void UJsonTreeViewerWidget::ShowDocument(const TSharedRef<FJsonTreeDocument>& Document)
 {
-    // Use default Slate texboxt font if no custom font is provided
-    const FSlateFontInfo DefaultFont(FPaths::EngineContentDir() / TEXT("Slate/Fonts/Roboto-Regular.ttf"), 9);
+    BeginLoad();
+    _bDocumentSet = true;
 
-    // Create the treeview row widget
-    return SNew(STableRow<TSharedPtr<class FTreeItem>>, OwnerTable)
-        [
-            SNew(SHorizontalBox)
-                + SHorizontalBox::Slot()
-                .Padding(Padding)
-                .AutoWidth()
-                [
-                    SNew(SEditableText)
-                        .IsReadOnly(true)
-                        .Visibility(Item->Key.IsEmpty() ? EVisibility::Collapsed : EVisibility::Visible)
-                        .Text(FText::FromString(Item->Key))
-                        .ColorAndOpacity(Item->Key.Left(1) == TEXT("@") ? KeyAtColor : KeyColor) // '@' keys get special color
-                        .Font(!Font.FontObject ? DefaultFont : Font)
-                ]
-                + SHorizontalBox::Slot()
-                .Padding(Padding)
-                .AutoWidth()
-                [
-                    SNew(STextBlock)
-                        .Visibility(Item->Key.IsEmpty() ? EVisibility::Collapsed : EVisibility::Visible)
-                        .Text(FText::FromString(":"))
-                        .Font(!Font.FontObject ? DefaultFont : Font)
-                ]
-                + SHorizontalBox::Slot()
-                .Padding(Padding)
-                .AutoWidth()
-                [
-                    SNew(SEditableText)
-                        .IsReadOnly(true)
-                        .Visibility(Item->Value.IsEmpty() ? EVisibility::Collapsed : EVisibility::Visible)
-                        .Text(FText::FromString(Item->Value))
-                        .ColorAndOpacity(GetValueColorFromJsonType(Item->ValueType)) // Color based on value type
-                        .Font(!Font.FontObject ? DefaultFont : Font)
-                ]
-        ];
+    FJsonTreeLoadResult Result;
+    FillFromDocument(Document, GetLoadOptions(), Result);
+    ApplyLoadResult(Result);
 }
 
-void UJsonTreeViewerWidget::GetChildren(TSharedPtr<class FTreeItem> Item, TArray<TSharedPtr<class FTreeItem>>& OutChildren)
+bool UJsonTreeViewerWidget::IsLoading() const
 {
-    // Provide the child items for a given tree node
-    OutChildren = Item->ChildItems;
+    return _bLoading;
 }
 
-bool UJsonTreeViewerWidget::IsValidJson(const FString& JsonString)
+FJsonTreeLoadOptions UJsonTreeViewerWidget::GetLoadOptions() const
 {
-    // Attempt to deserialize into a JSON object to check validity
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(JsonString);
-    TSharedPtr<FJsonObject> JsonObject;
+    FJsonTreeLoadOptions Options;
+    Options.bLazyChildren = bLazyChildren;
+    Options.bParallelBuild = bParallelBuild;
+    Options.bBuildSearchIndex = bShowSearchBox;
+    // Lazy children are built in the tree, so a lazy tree is never shared
+    Options.bUseDocumentCache = bShareDocuments && !bIncrementalUpdate && !(bLazyChildren && RetainSource != EJsonTreeRetainSource::None);
+    Options.bUseSnapshot = bUseTreeSnapshots && !bIncrementalUpdate;
+    Options.RetainSource = RetainSource;
+    return Options;
+}
 
-    return FJsonSerializer::Deserialize(JsonReader, JsonObject);
+bool UJsonTreeViewerWidget::IsInputShown() const
+{
+    if (!_LoadedInput.IsValid() || !_NodeStore.IsValid())
+    {
+        return false;
+    }
+    const FJsonTreeLoadOptions Options = GetLoadOptions();
+    return _LoadedInput->Matches(FJsonTreeDocumentKey::Make(JsonInput, Options), Options);
 }
 
-bool UJsonTreeViewerWidget::ParseJsonContents(FString JsonString, TSharedPtr<FJsonValue>& OutJsonValue)
+uint32 UJsonTreeViewerWidget::BeginLoad()
 {
-    // If valid JSON, deserialize into a JsonValue container
-    if (IsValidJson(JsonString))
+    StopTailing();
+    StopTimeSlicedLoad();
+    _bDocumentSet = false;
+    _LoadedInput.Reset();
+
+    if (_LoadCancelled.IsValid())
     {
-        TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(JsonString);
-        return FJsonSerializer::Deserialize(JsonReader, OutJsonValue);
+        _LoadCancelled->AtomicSet(true);
     }
-    return false;
+    _LoadCancelled = MakeShared<FThreadSafeBool, ESPMode::ThreadSafe>(false);
+    _bLoading = false;
+    _bBuildingFilterTree = false;
+    return ++_LoadSerial;
+}
+
+void UJsonTreeViewerWidget::BeginTimeSlicedLoad(const FString& JsonPathOrString, const FJsonTreeLoadOptions& Options, FJsonTreeLoadResult& Result)
+{
+    _SlicedLoad = MakeShared<FJsonTreeSlicedLoad>();
+    _SlicedLoad->JsonPathOrString = JsonPathOrString;
+    _SlicedLoad->Options = Options;
+    _SlicedLoad->Result = MoveTemp(Result);
+
+    // Nothing happens before the first tick, so listeners see events in the same order as for a background load
+    _SliceTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UJsonTreeViewerWidget::TickTimeSlicedLoad));
 }
 
-void UJsonTreeViewerWidget::BuildTree(TSharedPtr<FJsonValue>& JsonValue)
+bool UJsonTreeViewerWidget::TickTimeSlicedLoad(float DeltaTime)
 {
-    _TreeItems.Reset();  // Clear any existing tree
+    JSONTREEVIEWER_TRACE_SCOPE("UJsonTreeViewerWidget::TickTimeSlicedLoad");
+    FJsonTreeSlicedLoad& Load = *_SlicedLoad;
+    FJsonTreeLoadResult& Result = Load.Result;
 
-    // Handle array at root
-    if (JsonValue->Type == EJson::Array)
+    if (!Result.NodeStore.IsValid())
     {
-        for (auto& Element : JsonValue->AsArray())
+        // Mapping a file takes no time; a raw JSON string is converted to UTF-8 in one go
+        Load.Source = FJsonTreeDocument::OpenSource(Load.JsonPathOrString, Result.JsonFilePath, Result.Stats, Result.Error);
+        if (!Load.Source.IsValid())
+        {
+            FinishTimeSlicedLoad();
+            return false;
+        }
+
+        // A parallel build and tree snapshots would need worker threads, so this is always a serial parse
+        const bool bLazy = Load.Options.bLazyChildren && Load.Options.RetainSource != EJsonTreeRetainSource::None;
+        Result.NodeStore = MakeShared<FJsonTreeNodeStore>();
+        Result.NodeStore->BeginBuild(Load.Source.ToSharedRef(), bLazy);
+
+        if (!bIncrementalUpdate || !_OwnedStore.IsValid())
         {
-            _TreeItems.Add(ParseNode(Element));
+            ShowGrowingTree();
         }
+        OnLoadProgress.Broadcast(0.1f);
+        return true;
+    }
+
+    // A stream that outgrew its buffer fails like a document with a syntax error
+    if (!Result.Error.IsEmpty())
+    {
+        Result.NodeStore.Reset();
+        UE_LOG(LogTemp, Warning, TEXT("Failed to read the JSON stream (%s)! Aborting!"), *Result.Error);
+        FinishTimeSlicedLoad();
+        return false;
     }
-    // Handle object at root
-    else if (JsonValue->Type == EJson::Object)
+
+    FJsonTreeNodeStore& Store = *Result.NodeStore;
+    const double SliceStart = FPlatformTime::Seconds();
+    const EJsonTreeBuildStep Step = Store.ContinueBuild(TimeSliceBudgetMs / 1000.0, Result.Error, Result.ErrorLine, Result.ErrorColumn);
+    Load.ParseSeconds += FPlatformTime::Seconds() - SliceStart;
+
+    if (Step == EJsonTreeBuildStep::Pending)
     {
-        for (auto& Pair : JsonValue->AsObject()->Values)
+        if (Load.bShowPartial)
         {
-            TSharedPtr<FTreeItem> Parsed = ParseNode(Pair.Value);
-            TSharedPtr<FTreeItem> Row = MakeShared<FTreeItem>(Pair.Key, Parsed->Value, Parsed->ValueType);
-            if (Parsed->ChildItems.Num() > 0)
+            const int32 NumShown = _TreeItems.Num();
+            Store.GetNewTopLevelItems(_TreeItems);
+            if (_TreeItems.Num() != NumShown && _TreeView.IsValid())
             {
-                Row->ChildItems = Parsed->ChildItems;
+                _TreeView->RequestTreeRefresh();
             }
-            _TreeItems.Add(Row);
         }
+        if (!Load.bStream)
+        {
+            OnLoadProgress.Broadcast(0.1f + 0.9f * Store.GetBuildProgress());
+        }
+        else if (Load.ExpectedBytes > 0)
+        {
+            OnLoadProgress.Broadcast(0.1f + 0.9f * FMath::Min(float(double(Load.Source->Num()) / double(Load.ExpectedBytes)), 1.f));
+        }
+        return true;
+    }
+
+    Result.Stats.ParseMs = Load.ParseSeconds * 1000.0;
+    if (Step == EJsonTreeBuildStep::Done)
+    {
+        if (Result.JsonFilePath.IsEmpty())
+        {
+            UE_LOG(LogTemp, Log, TEXT("This appears to be a valid JSON string..."));
+        }
+        Result.Stats.Nodes = Store.Num();
+        if (Load.bStream)
+        {
+            Result.Stats.Bytes = Load.Source->Num();
+        }
+        if (Result.bCacheable)
+        {
+            // The tree goes into the document cache, so it becomes read-only; a cacheable load is never lazy
+            const bool bRetainSource = Load.Options.RetainSource != EJsonTreeRetainSource::None;
+            const TSharedRef<FJsonTreeDocument> Document = MakeShared<FJsonTreeDocument>(Result.NodeStore.ToSharedRef(), bRetainSource ? Load.Source : nullptr,
+                Load.Options.bBuildSearchIndex ? Load.Source : nullptr, Result.JsonFilePath, Result.Stats);
+            Result.NodeStore.Reset();
+            FillFromLoadedDocument(Load.JsonPathOrString, Load.Options, Document, Result);
+        }
+        else
+        {
+            FJsonTreeDocument::FLoadedTree Tree;
+            Tree.NodeStore = MoveTemp(Result.NodeStore);
+            Tree.Source = Load.Source;
+            Tree.FilePath = Result.JsonFilePath;
+            Tree.Stats = Result.Stats;
+            FillFromLoadedTree(Load.JsonPathOrString, Load.Options, Tree, Result);
+        }
+        Load.Source.Reset();
     }
-    // Handle single primitive at root
     else
     {
-        _TreeItems.Add(ParseNode(JsonValue));
+        Result.NodeStore.Reset();
+        UE_LOG(LogTemp, Warning, TEXT("Failed to parse JSON (%s) at line %d, column %d! Aborting!"), *Result.Error, Result.ErrorLine, Result.ErrorColumn);
+    }
+    FinishTimeSlicedLoad();
+    return false;
+}
+
+void UJsonTreeViewerWidget::ShowGrowingTree()
+{
+    FJsonTreeSlicedLoad& Load = *_SlicedLoad;
+    Load.bShowPartial = true;
+    Load.PreviousStore = MoveTemp(_NodeStore);
+    Load.PreviousOwnedStore = MoveTemp(_OwnedStore);
+    Load.PreviousItems = MoveTemp(_TreeItems);
+    _OwnedStore = Load.Result.NodeStore;
+    _NodeStore = _OwnedStore;
+    _TreeItems.Reset();
+    ResetRowTexts();
+    ShowTree();
+
+    // The old index doesn't match the growing tree; a search made meanwhile waits for the new one
+    ResetSearch();
+    _Search->SetIndexPending(Load.Options.bBuildSearchIndex);
+    if (_FilterView.IsValid())
+    {
+        ApplyFilter();
+    }
+    if (_TreeView.IsValid())
+    {
+        _TreeView->RequestTreeRefresh();
+    }
+}
+
+void UJsonTreeViewerWidget::InitJsonTreeFromStream(int64 ExpectedBytes)
+{
+    BeginLoad();
+
+    // Rebuilds keep the stream going instead of loading JsonInput
+    _bDocumentSet = true;
+    _bLoading = true;
+
+    _SlicedLoad = MakeShared<FJsonTreeSlicedLoad>();
+    FJsonTreeSlicedLoad& Load = *_SlicedLoad;
+    Load.Options = GetLoadOptions();
+    Load.bStream = true;
+    Load.ExpectedBytes = FMath::Max<int64>(ExpectedBytes, 0);
+    Load.Source = FJsonTreeSource::FromStream(Load.ExpectedBytes);
+
+    // Nothing is cached or patched: streamed text has no key to find it by, and the point is seeing it early
+    const bool bLazy = Load.Options.bLazyChildren && Load.Options.RetainSource != EJsonTreeRetainSource::None;
+    Load.Result.NodeStore = MakeShared<FJsonTreeNodeStore>();
+    Load.Result.NodeStore->BeginStreamBuild(Load.Source.ToSharedRef(), bLazy);
+    ShowGrowingTree();
+
+    _SliceTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UJsonTreeViewerWidget::TickTimeSlicedLoad));
+    OnLoadProgress.Broadcast(0.1f);
+}
+
+bool UJsonTreeViewerWidget::AppendJsonTreeStream(const TArray<uint8>& Bytes)
+{
+    return AppendJsonTreeStreamBytes(Bytes);
+}
+
+bool UJsonTreeViewerWidget::AppendJsonTreeStreamBytes(TConstArrayView<uint8> Bytes)
+{
+    if (!IsStreaming() || !_SlicedLoad->Result.Error.IsEmpty())
+    {
+        return false;
+    }
+
+    // The parsing happens on the next tick, within the frame's budget
+    FJsonTreeLoadResult& Result = _SlicedLoad->Result;
+    if (!Result.NodeStore->AppendBuildInput(Bytes))
+    {
+        Result.Error = TEXT("The JSON stream is larger than 2 GB");
+        return false;
+    }
+    return true;
+}
+
+bool UJsonTreeViewerWidget::EndJsonTreeStream()
+{
+    if (!IsStreaming())
+    {
+        return false;
     }
+    _SlicedLoad->bStreamEnded = true;
+    if (_SlicedLoad->Result.Error.IsEmpty())
+    {
+        _SlicedLoad->Result.NodeStore->EndBuildInput();
+    }
+    return true;
+}
+
+bool UJsonTreeViewerWidget::IsStreaming() const
+{
+    return _SlicedLoad.IsValid() && _SlicedLoad->bStream && !_SlicedLoad->bStreamEnded;
 }
 
-TSharedPtr<FTreeItem> UJsonTreeViewerWidget::ParseNode(const TSharedPtr<FJsonValue>& JsonValue)
+void UJsonTreeViewerWidget::FinishTimeSlicedLoad()
 {
-    // Create a new tree item for this JSON value
-    TSharedPtr<FTreeItem> Node = MakeShared<FTreeItem>(JsonValue->Type);
+    // The ticker removes itself by returning false
+    _SliceTicker.Reset();
+    const TSharedRef<FJsonTreeSlicedLoad> Load = _SlicedLoad.ToSharedRef();
+    StopTimeSlicedLoad();
 
-    switch (JsonValue->Type)
+    // A failed load keeps the previous tree, which gets its search index and filter back
+    if (!Load->Result.Error.IsEmpty() && Load->bShowPartial)
     {
-    case EJson::Object:
-        // Recurse into each member of the object
-        for (auto& Pair : JsonValue->AsObject()->Values)
+        if (Load->Options.bBuildSearchIndex && _JsonSource.IsValid())
         {
-            TSharedPtr<FTreeItem> Parsed = ParseNode(Pair.Value);
-            TSharedPtr<FTreeItem> Child = MakeShared<FTreeItem>(Pair.Key, Parsed->Value, Parsed->ValueType);
-            if (Parsed->ChildItems.Num() > 0)
-            {
-                Child->ChildItems = Parsed->ChildItems;
-            }
-            Node->ChildItems.Add(Child);
+            BuildSearchIndex(_JsonSource.ToSharedRef());
         }
-        break;
-
-    case EJson::Array:
-        // Flatten array elements under this node
-        for (auto& Element : JsonValue->AsArray())
+        if (_FilterView.IsValid())
         {
-            TSharedPtr<FTreeItem> Parsed = ParseNode(Element);
-            if (Parsed->ChildItems.Num() > 0)
-            {
-                Node->ChildItems.Append(Parsed->ChildItems);
-            }
-            else
-            {
-                Node->ChildItems.Add(Parsed);
-            }
+            ApplyFilter();
         }
-        break;
+    }
+    _bLoading = false;
+    ApplyLoadResult(Load->Result);
+}
 
-    case EJson::String:
+void UJsonTreeViewerWidget::StopTimeSlicedLoad()
+{
+    if (_SliceTicker.IsValid())
     {
-        // Extract string value
-        JsonValue->TryGetString(Node->Value);
-        Node->ValueType = EJson::String;
-        break;
+        FTSTicker::GetCoreTicker().RemoveTicker(_SliceTicker);
+        _SliceTicker.Reset();
     }
-
-    case EJson::Number:
+    if (!_SlicedLoad.IsValid())
     {
-        // Extract numeric value and sanitize to string
-        double NumberValue = 0;
-        JsonValue->TryGetNumber(NumberValue);
-        Node->Value = FString::SanitizeFloat(NumberValue);
-        Node->ValueType = EJson::Number;
-        break;
+        return;
     }
 
-    case EJson::Boolean:
+    // Everything up to ApplyLoadResult starts from the tree displayed before the load
+    if (_SlicedLoad->bShowPartial)
     {
-        // Extract boolean value and convert to text
-        bool BoolValue = false;
-        JsonValue->TryGetBool(BoolValue);
-        Node->Value = BoolValue ? TEXT("true") : TEXT("false");
-        Node->ValueType = EJson::Boolean;
-        break;
+        _NodeStore = MoveTemp(_SlicedLoad->PreviousStore);
+        _OwnedStore = MoveTemp(_SlicedLoad->PreviousOwnedStore);
+        _TreeItems = MoveTemp(_SlicedLoad->PreviousItems);
+        ResetRowTexts();
+        _Search->SetIndexPending(false);
+        if (_TreeView.IsValid())
+        {
+            _TreeView->RequestTreeRefresh();
+        }
     }
+    _SlicedLoad.Reset();
+}
+
+void UJsonTreeViewerWidget::ApplyLoadResult(FJsonTreeLoadResult& Result)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("UJsonTreeViewerWidget::ApplyLoadResult");
+    _LoadStats = Result.Stats;
+    _LoadError = Result.Error;
+    _LoadErrorLine = Result.ErrorLine;
+    _LoadErrorColumn = Result.ErrorColumn;
 
-    case EJson::Null:
+    if (!Result.Error.IsEmpty())
     {
-        // Display null in case of null data
-        Node->Value = TEXT("null");
-        Node->ValueType = EJson::Null;
-        break;
+        // Keep showing the previous tree; only the error is new
+        _bValidJson = false;
+        OnLoadFailed.Broadcast(_LoadError, _LoadErrorLine, _LoadErrorColumn);
+        return;
     }
 
-    default:
-        // Ignore the Nothing type data
-        break;
+    _bValidJson = true;
+    _LoadedInput = MoveTemp(Result.Input);
+    if (Result.bFromFile)
+    {
+        JsonInput = Result.JsonFilePath;
+        _JsonFilePath = MoveTemp(Result.JsonFilePath);
+    }
+    else
+    {
+        JsonInput = MoveTemp(Result.JsonString);
+    }
+
+    // A document that comes back unchanged, e.g. from the cache after a rebuild, keeps what was
+    // derived from it
+    const bool bSameDocument = Result.Document.IsValid() && Result.Document == _Document;
+    if (Result.bCacheable && !Result.bCacheHit && Result.Document.IsValid())
+    {
+        FJsonTreeViewerModule::Get().GetDocumentCache().Add(Result.CacheKey, Result.Document.ToSharedRef());
+    }
+
+    // Patching changes the node store in place, so it only happens between trees of the widget's own
+    const bool bPatch = bIncrementalUpdate && _OwnedStore.IsValid() && _TreeView.IsValid() && Result.NodeStore.IsValid();
+    _Document = MoveTemp(Result.Document);
+
+    _JsonSource = MoveTemp(Result.Source);
+    if (!bSameDocument)
+    {
+        _JsonValue.Reset();
+        ShowTree();
+    }
+
+    if (bPatch)
+    {
+        ApplyIncrementalUpdate(Result);
+    }
+    else
+    {
+        ResetRowTexts();
+        _OwnedStore = MoveTemp(Result.NodeStore);
+        if (_OwnedStore.IsValid())
+        {
+            _NodeStore = _OwnedStore;
+        }
+        else
+        {
+            _NodeStore = _Document->GetNodeStore();
+        }
+        _TreeItems = MoveTemp(Result.TreeItems);
+
+        if (_TreeView.IsValid())
+        {
+            _TreeView->RequestTreeRefresh();
+        }
+    }
+
+    // BeginLoad cancelled any indexing still under way, so only a finished index carries over
+    if (!bSameDocument || !_Search->GetIndex().IsValid())
+    {
+        ResetSearch();
+        if (Result.SearchIndex.IsValid())
+        {
+            _Search->SetIndex(Result.SearchIndex);
+            if (!_Search->GetQuery().IsEmpty())
+            {
+                RunSearch();
+            }
+        }
+        else if (Result.SearchSource.IsValid())
+        {
+            BuildSearchIndex(Result.SearchSource.ToSharedRef());
+        }
+    }
+
+    if (_FilterView.IsValid())
+    {
+        ApplyFilter();
+    }
+
+    OnLoadCompleted.Broadcast(_LoadStats);
+}
+
+void UJsonTreeViewerWidget::ApplyIncrementalUpdate(FJsonTreeLoadResult& Result)
+{
+    // Once most of the store is dead nodes, starting from the new store is cheaper than patching it again
+    if (_OwnedStore->GetNumDeadNodes() > uint32(_OwnedStore->Num() / 2))
+    {
+        ReplaceTreeKeepingState(Result.NodeStore.ToSharedRef(), MoveTemp(Result.TreeItems));
+        return;
+    }
+
+    FJsonTreePatchResult Patch;
+    FString PatchError;
+    if (!_OwnedStore->Patch(*Result.NodeStore, Patch, PatchError))
+    {
+        // The new store holds the same document and fits, so it is shown instead
+        UE_LOG(LogTemp, Warning, TEXT("Failed to patch the tree in place (%s); showing the new tree instead"), *PatchError);
+        ReplaceTreeKeepingState(Result.NodeStore.ToSharedRef(), MoveTemp(Result.TreeItems));
+        return;
+    }
+    _LoadStats.Nodes = _OwnedStore->Num();
+
+    // Only rows whose node changed are rebuilt; every other row widget stays as it is
+    for (const FJsonTreeNode* Node : Patch.ChangedNodes)
+    {
+        _RowTextCache.Remove(Node);
+        if (TSharedPtr<ITableRow> Row = _TreeView->WidgetFromItem(Node))
+        {
+            StaticCastSharedRef<STableRow<const FJsonTreeNode*>>(Row->AsWidget())->SetContent(MakeRowContent(*Node));
+        }
+    }
+
+    if (Patch.bStructureChanged)
+    {
+        _ChildLists->ForgetLists();
+        _OwnedStore->GetTopLevelItems(_TreeItems);
+        _TreeView->RequestTreeRefresh();
+    }
+}
+
+void UJsonTreeViewerWidget::ReplaceTreeKeepingState(const TSharedRef<FJsonTreeNodeStore>& NodeStore, TArray<const FJsonTreeNode*>&& TreeItems)
+{
+    const TSharedPtr<const FJsonTreeNodeStore> OldNodeStore = MoveTemp(_NodeStore);
+    ResetRowTexts();
+    _OwnedStore = NodeStore;
+    _NodeStore = _OwnedStore;
+    _TreeItems = MoveTemp(TreeItems);
+    _LoadStats.Nodes = _NodeStore->Num();
+    if (!_TreeView.IsValid() || !OldNodeStore.IsValid())
+    {
+        return;
+    }
+
+    const FJsonTreeExpansion Expansion = FJsonTreeExpansion::Save(*_TreeView);
+    Expansion.RestoreByPath(*_TreeView, *OldNodeStore, *_OwnedStore);
+
+    _TreeView->RequestTreeRefresh();
+    _TreeView->SetScrollOffset(Expansion.ScrollOffset);
+}
+
+bool UJsonTreeViewerWidget::StartTailingFile(const FString& FilePath, int32 MaxRecords)
+{
+    BeginLoad();
+
+    if (!FPaths::FileExists(FilePath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to read the file: %s"), *FilePath);
+        return false;
+    }
+
+    _bValidJson = true;
+    _LoadError.Empty();
+    _LoadStats = FJsonTreeLoadStats();
+    _JsonFilePath = FilePath;
+    _JsonSource.Reset();
+    _JsonValue.Reset();
+    _Document.Reset();
+    ResetRowTexts();
+    ResetSearch();
+    ClearFilter();
+    ShowTree();
+
+    _OwnedStore = MakeShared<FJsonTreeNodeStore>();
+    _OwnedStore->ResetToRecords();
+    _NodeStore = _OwnedStore;
+    _TreeItems.Reset();
+    if (_TreeView.IsValid())
+    {
+        _TreeView->ClearExpandedItems();
+        _TreeView->RebuildList();
+    }
+
+    _Tail = MakeShared<FJsonTreeTail>(FilePath, MaxRecords);
+    _TailTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UJsonTreeViewerWidget::PollTail), TailPollInterval);
+
+    // Pick up what the file already holds without waiting for the first tick
+    PollTail(0.f);
+    return true;
+}
+
+void UJsonTreeViewerWidget::StopTailing()
+{
+    if (_TailTicker.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(_TailTicker);
+        _TailTicker.Reset();
+    }
+}
+
+bool UJsonTreeViewerWidget::PollTail(float DeltaTime)
+{
+    bool bRestarted = false;
+    const int64 FileSize = _Tail->Poll(bRestarted);
+    if (bRestarted)
+    {
+        // What was read no longer describes the file
+        ResetRowTexts();
+        _OwnedStore->ResetToRecords();
+        _TreeItems.Reset();
+        if (_TreeView.IsValid())
+        {
+            _TreeView->ClearExpandedItems();
+            _TreeView->RebuildList();
+        }
+    }
+    if (FileSize == INDEX_NONE)
+    {
+        return true;
+    }
+
+    TWeakObjectPtr<UJsonTreeViewerWidget> WeakThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Serial = _LoadSerial, Read = _Tail->BeginRead(FileSize)]()
+    {
+        TSharedRef<FJsonTreeTailBatch> Batch = Read();
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, Batch]()
+        {
+            UJsonTreeViewerWidget* Widget = WeakThis.Get();
+            if (Widget && Widget->_LoadSerial == Serial && Widget->IsTailing())
+            {
+                Widget->ApplyTailBatch(*Batch);
+            }
+        });
+    });
+
+    return true;
+}
+
+void UJsonTreeViewerWidget::ApplyTailBatch(const FJsonTreeTailBatch& Batch)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("UJsonTreeViewerWidget::ApplyTailBatch");
+    TArray<const FJsonTreeNode*> Appended;
+    FString AppendError;
+    const int32 NumDropped = _Tail->ApplyBatch(Batch, *_OwnedStore, _TreeItems, Appended, AppendError);
+
+    // Dropped records leave dead nodes behind; once they outnumber the live ones, the store is compacted
+    if (_OwnedStore->GetNumDeadNodes() > uint32(_OwnedStore->Num() / 2))
+    {
+        CompactTailRecords();
+    }
+
+    _LoadStats.Bytes = _Tail->GetOffset();
+    _LoadStats.Nodes = _NodeStore->Num() - int32(_NodeStore->GetNumDeadNodes());
+
+    if (_TreeView.IsValid())
+    {
+        _TreeView->RequestTreeRefresh();
+    }
+
+    if (!Batch.Error.IsEmpty())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to parse JSON record (%s) at line %d, column %d of %s"), *Batch.Error, Batch.ErrorLine, Batch.ErrorColumn, *_Tail->GetFilePath());
+        _LoadError = Batch.Error;
+        _LoadErrorLine = Batch.ErrorLine;
+        _LoadErrorColumn = Batch.ErrorColumn;
+        OnLoadFailed.Broadcast(_LoadError, _LoadErrorLine, _LoadErrorColumn);
+    }
+    if (!AppendError.IsEmpty())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Skipped the records read from %s (%s)"), *_Tail->GetFilePath(), *AppendError);
+        _LoadError = MoveTemp(AppendError);
+        _LoadErrorLine = 0;
+        _LoadErrorColumn = 0;
+        OnLoadFailed.Broadcast(_LoadError, _LoadErrorLine, _LoadErrorColumn);
+    }
+    if (Appended.Num() > 0 || NumDropped > 0)
+    {
+        OnRecordsAppended.Broadcast(Appended.Num(), NumDropped);
+    }
+}
+
+void UJsonTreeViewerWidget::CompactTailRecords()
+{
+    FJsonTreeExpansion Expansion;
+    if (_TreeView.IsValid())
+    {
+        Expansion = FJsonTreeExpansion::Save(*_TreeView);
+    }
+
+    TArray<uint32> Remap;
+    _OwnedStore->Compact(Remap);
+    _OwnedStore->GetTopLevelItems(_TreeItems);
+
+    // Every node moved, so nothing keyed by node pointer is valid any more
+    ResetRowTexts();
+    if (_TreeView.IsValid())
+    {
+        Expansion.RestoreByRemap(*_TreeView, *_NodeStore, Remap);
+        _TreeView->RebuildList();
+    }
+}
+
+void UJsonTreeViewerWidget::Search(const FString& Query)
+{
+    _Search->SetQuery(Query);
+    if (_SearchBox.IsValid() && !_SearchBox->GetText().ToString().Equals(Query, ESearchCase::CaseSensitive))
+    {
+        _SearchBox->SetText(_Search->GetHighlight());
+    }
+
+    // Rows in view pick up the new highlight right away; the matches follow once the search is done
+    if (_TreeView.IsValid())
+    {
+        _TreeView->RebuildList();
+    }
+
+    if (Query.IsEmpty())
+    {
+        OnSearchCompleted.Broadcast(0);
+    }
+    else if (_Search->GetIndex().IsValid())
+    {
+        RunSearch();
+    }
+    else if (!_Search->IsIndexing())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Search needs bShowSearchBox set when the document is loaded"));
+        OnSearchCompleted.Broadcast(0);
+    }
+}
+
+void UJsonTreeViewerWidget::ClearSearch()
+{
+    Search(FString());
+}
+
+int32 UJsonTreeViewerWidget::GetNumSearchResults() const
+{
+    return _Search->GetMatches().Num();
+}
+
+void UJsonTreeViewerWidget::ShowNextSearchResult()
+{
+    const int32 NumMatches = _Search->GetMatches().Num();
+    if (NumMatches == 0 || !_Search->GetIndex().IsValid())
+    {
+        return;
+    }
+
+    _Search->SetResultIndex((_Search->GetResultIndex() + 1) % NumMatches);
+    const FJsonTreeNode* Item = RevealSearchMatch(_Search->GetResultIndex());
+    _LoadStats.Nodes = _NodeStore->Num();
+    if (Item && _TreeView.IsValid())
+    {
+        _TreeView->RequestTreeRefresh();
+        _TreeView->RequestScrollIntoView(Item);
+    }
+}
+
+void UJsonTreeViewerWidget::ResetSearch()
+{
+    _Search->Reset();
+}
+
+void UJsonTreeViewerWidget::BuildSearchIndex(const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe>& Source)
+{
+    // The index belongs to the load, so the next load cancels it along with everything else
+    TWeakObjectPtr<UJsonTreeViewerWidget> WeakThis(this);
+    _Search->BuildIndex(Source, _LoadCancelled.ToSharedRef(), [WeakThis]()
+    {
+        UJsonTreeViewerWidget* Widget = WeakThis.Get();
+        if (!Widget)
+        {
+            return;
+        }
+
+        // Other widgets showing the same document can use it straight away
+        if (Widget->_Document.IsValid())
+        {
+            Widget->_Document->SetSearchIndex(Widget->_Search->GetIndex());
+        }
+
+        // A search made while indexing was waiting for this
+        if (!Widget->_Search->GetQuery().IsEmpty())
+        {
+            Widget->RunSearch();
+        }
+    });
+}
+
+void UJsonTreeViewerWidget::RunSearch()
+{
+    TWeakObjectPtr<UJsonTreeViewerWidget> WeakThis(this);
+    _Search->Run([WeakThis]()
+    {
+        if (UJsonTreeViewerWidget* Widget = WeakThis.Get())
+        {
+            Widget->ApplySearchResults();
+        }
+    });
+}
+
+void UJsonTreeViewerWidget::ApplySearchResults()
+{
+    JSONTREEVIEWER_TRACE_SCOPE("UJsonTreeViewerWidget::ApplySearchResults");
+
+    // Revealing a match builds the lazy children along its path, so only the first matches are
+    // revealed up front; ShowNextSearchResult reveals the others as it gets to them
+    const FJsonTreeNode* FirstItem = nullptr;
+    const int32 NumMatches = _Search->GetMatches().Num();
+    const int32 NumRevealed = FMath::Min(NumMatches, MaxRevealedSearchResults);
+    for (int32 MatchIndex = 0; MatchIndex < NumRevealed; ++MatchIndex)
+    {
+        const FJsonTreeNode* Item = RevealSearchMatch(MatchIndex);
+        if (Item && !FirstItem)
+        {
+            FirstItem = Item;
+            _Search->SetResultIndex(MatchIndex);
+        }
+    }
+    _LoadStats.Nodes = _NodeStore->Num();
+
+    if (_TreeView.IsValid())
+    {
+        _TreeView->RequestTreeRefresh();
+        if (FirstItem)
+        {
+            _TreeView->RequestScrollIntoView(FirstItem);
+        }
+    }
+
+    OnSearchCompleted.Broadcast(NumMatches);
+}
+
+const FJsonTreeNode* UJsonTreeViewerWidget::RevealSearchMatch(int32 MatchIndex)
+{
+    // A tree of the widget's own gets the lazy children along the path built
+    TArray<FJsonTreePathStep> Path;
+    _Search->GetIndex()->GetPath(_Search->GetMatches()[MatchIndex], Path);
+    const uint32 Index = _OwnedStore.IsValid() ? _OwnedStore->FindNodeAtPath(Path) : _NodeStore->FindNodeAtPath(Path);
+    if (Index == FJsonTreeNodeStore::InvalidIndex)
+    {
+        return nullptr;
+    }
+
+    const FJsonTreeNode& Item = _NodeStore->GetNode(Index);
+    ExpandAncestors(Item);
+    return &Item;
+}
+
+void UJsonTreeViewerWidget::ExpandAncestors(const FJsonTreeNode& Item)
+{
+    if (!_TreeView.IsValid())
+    {
+        return;
+    }
+
+    // The root isn't an item of the tree, so everything between it and Item is expanded
+    const FJsonTreeNode* Child = &Item;
+    for (uint32 Parent = Item.Parent; Parent != FJsonTreeNodeStore::InvalidIndex;)
+    {
+        const FJsonTreeNode& Ancestor = _NodeStore->GetNode(Parent);
+        if (Ancestor.Parent != FJsonTreeNodeStore::InvalidIndex)
+        {
+            _TreeView->SetItemExpansion(&Ancestor, true);
+
+            // A child past the ancestor's "... N more" row gets listed, along with the ones before it
+            const uint32 NumShown = GetNumShownChildren(Ancestor);
+            if (Ancestor.NumChildren > NumShown)
+            {
+                uint32 Position = 0;
+                for (uint32 Sibling = Ancestor.FirstChild; &_NodeStore->GetNode(Sibling) != Child; Sibling = _NodeStore->GetNode(Sibling).NextSibling)
+                {
+                    ++Position;
+                }
+                if (Position >= NumShown)
+                {
+                    ShowMoreChildren(Ancestor, Align(Position + 1, uint32(MaxShownChildren)));
+                }
+            }
+        }
+        Child = &Ancestor;
+        Parent = Ancestor.Parent;
+    }
+}
+
+bool UJsonTreeViewerWidget::ExpandAll()
+{
+    return ExpandItems(MAX_int32);
+}
+
+void UJsonTreeViewerWidget::CollapseAll()
+{
+    if (_TreeView.IsValid())
+    {
+        _TreeView->ClearExpandedItems();
+        _TreeView->RequestTreeRefresh();
+    }
+    _ChildLists->ForgetLists();
+}
+
+bool UJsonTreeViewerWidget::ExpandToDepth(int32 Depth)
+{
+    return ExpandItems(Depth);
+}
+
+bool UJsonTreeViewerWidget::ExpandItems(int32 Depth)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("UJsonTreeViewerWidget::ExpandItems");
+    if (!_TreeView.IsValid() || !_NodeStore.IsValid())
+    {
+        return true;
+    }
+
+    // The walk follows the store's links instead of asking the tree for children, and the tree
+    // only rebuilds its list once, on the next tick
+    _TreeView->ClearExpandedItems();
+    _ChildLists->ForgetLists();
+
+    FJsonTreeFilterView* FilterView = GetAppliedFilter();
+    return ExpandDescendants(FilterView ? FilterView->GetTopLevelItems() : _TreeItems, Depth);
+}
+
+bool UJsonTreeViewerWidget::ExpandDescendants(TConstArrayView<const FJsonTreeNode*> Items, int32 Depth)
+{
+    // Breadth first, so a budget that runs out leaves the deepest levels collapsed rather than
+    // the last top-level items
+    FJsonTreeFilterView* FilterView = GetAppliedFilter();
+    TArray<TPair<const FJsonTreeNode*, int32>> Queue;
+    Queue.Reserve(Items.Num());
+    for (const FJsonTreeNode* Item : Items)
+    {
+        Queue.Emplace(Item, 1);
+    }
+
+    TArray<const FJsonTreeNode*> Children;
+
+    int64 Budget = MaxExpandedItems;
+    bool bComplete = true;
+    for (int32 Head = 0; Head < Queue.Num(); ++Head)
+    {
+        const FJsonTreeNode& Item = *Queue[Head].Key;
+        const int32 Level = Queue[Head].Value;
+        if (!Item.IsContainer() || Level > Depth)
+        {
+            continue;
+        }
+
+        // Children behind a "... N more" row stay as they are
+        Children.Reset();
+        if (IsFilteredItem(Item))
+        {
+            FilterView->GetChildren(*_NodeStore, Item, Children, GetNumShownChildren(Item), false);
+        }
+        else
+        {
+            MaterializeChildren(Item);
+            _NodeStore->GetChildren(Item, Children, GetNumShownChildren(Item));
+        }
+        const uint32 NumShown = Children.Num();
+        if (NumShown == 0)
+        {
+            continue;
+        }
+        if (NumShown > Budget)
+        {
+            bComplete = false;
+            break;
+        }
+        Budget -= NumShown;
+        _TreeView->SetItemExpansion(&Item, true);
+
+        // A page lists elements of the array it belongs to, so they stay on the array's level
+        const int32 ChildLevel = Item.IsPage() ? Level : Level + 1;
+        for (const FJsonTreeNode* Child : Children)
+        {
+            Queue.Emplace(Child, ChildLevel);
+        }
+    }
+    _LoadStats.Nodes = _NodeStore->Num();
+    _TreeView->RequestTreeRefresh();
+
+    if (!bComplete)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Stopped expanding after %d items (MaxExpandedItems)"), MaxExpandedItems);
+    }
+    return bComplete;
+}
+
+bool UJsonTreeViewerWidget::SetFilter(const FJsonTreeFilter& Filter)
+{
+    if (IsTailing())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Filters are not available while tailing a file"));
+        return false;
+    }
+
+    _FilterView = MakeShared<FJsonTreeFilterView>(MakeNodeFilter(Filter));
+    ApplyFilter();
+    return true;
+}
+
+void UJsonTreeViewerWidget::ClearFilter()
+{
+    if (!_FilterView.IsValid())
+    {
+        return;
+    }
+    _FilterView.Reset();
+    ApplyFilter();
+}
+
+int32 UJsonTreeViewerWidget::GetNumFilterMatches() const
+{
+    const FJsonTreeFilterView* FilterView = GetAppliedFilter();
+    return FilterView ? FilterView->GetNumMatches() : 0;
+}
+
+FJsonTreeFilterView* UJsonTreeViewerWidget::GetAppliedFilter() const
+{
+    return _FilterView.IsValid() && _FilterView->IsApplied() ? _FilterView.Get() : nullptr;
+}
+
+bool UJsonTreeViewerWidget::IsFilteredItem(const FJsonTreeNode& Item) const
+{
+    const FJsonTreeFilterView* FilterView = GetAppliedFilter();
+    return FilterView && FilterView->IsFilteredItem(*_NodeStore, Item);
+}
+
+void UJsonTreeViewerWidget::ApplyFilter()
+{
+    JSONTREEVIEWER_TRACE_SCOPE("UJsonTreeViewerWidget::ApplyFilter");
+    if (_FilterView.IsValid())
+    {
+        _FilterView->Reset();
+        if (_NodeStore.IsValid() && !_NodeStore->IsBuilding() && !IsTailing())
+        {
+            // Children that aren't built yet aren't tested, so a lazy tree of the widget's own is
+            // replaced by a full one first; shared trees always are
+            if (_OwnedStore.IsValid() && _OwnedStore->IsLazy())
+            {
+                BuildFilterTree();
+            }
+            else
+            {
+                _FilterView->Apply(*_NodeStore);
+            }
+        }
+    }
+
+    // "... N more" rows count what the filter shows, so they are built again along with every other row
+    _ChildLists->ForgetLists();
+    for (const TPair<const FJsonTreeNode*, TUniquePtr<FJsonTreeNode>>& More : _ChildLists->GetMoreItems())
+    {
+        _RowTextCache.Remove(More.Value.Get());
+    }
+    if (_TreeView.IsValid())
+    {
+        const FJsonTreeFilterView* FilterView = GetAppliedFilter();
+        _TreeView->SetTreeItemsSource(FilterView ? &FilterView->GetTopLevelItems() : &_TreeItems);
+        _TreeView->RebuildList();
+    }
+}
+
+void UJsonTreeViewerWidget::BuildFilterTree()
+{
+    JSONTREEVIEWER_TRACE_SCOPE("UJsonTreeViewerWidget::BuildFilterTree");
+    if (_bBuildingFilterTree)
+    {
+        return;
+    }
+    _bBuildingFilterTree = true;
+
+    // The lazy tree keeps being shown and built as it is expanded meanwhile; a load started before
+    // the full tree is done discards it
+    TWeakObjectPtr<UJsonTreeViewerWidget> WeakThis(this);
+    const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe> Source = _OwnedStore->GetSource().ToSharedRef();
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Serial = _LoadSerial, Cancelled = _LoadCancelled, Source, bParallel = bParallelBuild]()
+    {
+        const TSharedRef<FJsonTreeNodeStore> NodeStore = MakeShared<FJsonTreeNodeStore>();
+        FString Error;
+        int32 ErrorLine = 0;
+        int32 ErrorColumn = 0;
+        if (!NodeStore->Build(Source, false, bParallel, [&Cancelled](float) { return !Cancelled.IsValid() || !*Cancelled; }, Error, ErrorLine, ErrorColumn))
+        {
+            return;
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, NodeStore]()
+        {
+            UJsonTreeViewerWidget* Widget = WeakThis.Get();
+            if (Widget && Widget->_LoadSerial == Serial && Widget->_bBuildingFilterTree)
+            {
+                Widget->_bBuildingFilterTree = false;
+                TArray<const FJsonTreeNode*> TreeItems;
+                NodeStore->GetTopLevelItems(TreeItems);
+                Widget->ReplaceTreeKeepingState(NodeStore, MoveTemp(TreeItems));
+                Widget->ApplyFilter();
+            }
+        });
+    });
+}
+
+uint32 UJsonTreeViewerWidget::FindNodeAtPath(const FString& Path)
+{
+    TArray<FString> Tokens;
+    if (!FJsonTreeLocation::Parse(Path, Tokens))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Not a JSON Pointer or supported JSONPath: %s"), *Path);
+        return FJsonTreeNodeStore::InvalidIndex;
+    }
+    if (!_NodeStore.IsValid() || _NodeStore->Num() == 0 || _NodeStore->IsBuilding())
+    {
+        return FJsonTreeNodeStore::InvalidIndex;
+    }
+
+    // One child lookup per level; only the containers on the path get their children built
+    uint32 Index = 0;
+    for (const FString& Token : Tokens)
+    {
+        const FJsonTreeNode& Node = _NodeStore->GetNode(Index);
+        MaterializeChildren(Node);
+        const EJson Type = Node.GetType();
+        uint32 Position = 0;
+        if (Type == EJson::Object)
+        {
+            const FTCHARToUTF8 Key(*Token, Token.Len());
+            Index = _NodeStore->FindChild(Index, FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Key.Get()), Key.Length()));
+        }
+        else if (Type == EJson::Array && FJsonTreeLocation::ParseArrayIndex(Token, Position))
+        {
+            Index = _NodeStore->GetElement(Index, Position);
+        }
+        else
+        {
+            Index = FJsonTreeNodeStore::InvalidIndex;
+        }
+
+        if (Index == FJsonTreeNodeStore::InvalidIndex)
+        {
+            UE_LOG(LogTemp, Log, TEXT("Nothing at \"%s\" in %s"), *Token, *Path);
+            break;
+        }
+    }
+    _LoadStats.Nodes = _NodeStore->Num();
+    return Index;
+}
+
+bool UJsonTreeViewerWidget::NavigateToPath(const FString& Path)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("UJsonTreeViewerWidget::NavigateToPath");
+    const uint32 Index = FindNodeAtPath(Path);
+    if (Index == FJsonTreeNodeStore::InvalidIndex)
+    {
+        return false;
     }
 
-    return Node;
+    const FJsonTreeNode& Item = _NodeStore->GetNode(Index);
+    if (_TreeView.IsValid())
+    {
+        ExpandAncestors(Item);
+        _TreeView->RequestTreeRefresh();
+        if (Item.Parent != FJsonTreeNodeStore::InvalidIndex || !Item.IsContainer())
+        {
+            _TreeView->RequestScrollIntoView(&Item);
+        }
+        else
+        {
+            // The root of a container document is the whole list
+            _TreeView->SetScrollOffset(0.f);
+        }
+    }
+    return true;
+}
+
+bool UJsonTreeViewerWidget::ShowTable(const FString& Path)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("UJsonTreeViewerWidget::ShowTable");
+    if (IsTailing())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Tables are not available while tailing a file"));
+        return false;
+    }
+
+    const uint32 Index = FindNodeAtPath(Path);
+    if (Index == FJsonTreeNodeStore::InvalidIndex)
+    {
+        return false;
+    }
+    // The table reads the elements' members, which a lazy tree of the widget's own builds first
+    if (_OwnedStore.IsValid())
+    {
+        _OwnedStore->MaterializeDescendants(Index, 2);
+    }
+    TSharedPtr<FJsonTreeTable> Table = FJsonTreeTable::Build(_NodeStore.ToSharedRef(), Index);
+    _LoadStats.Nodes = _NodeStore->Num();
+    if (!Table.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("%s is not an array of objects with at most %d member names"), *Path, FJsonTreeTable::MaxColumns);
+        return false;
+    }
+
+    _Table = MakeShared<FJsonTreeTableView>(Table.ToSharedRef());
+    RefreshTable();
+    return true;
+}
+
+void UJsonTreeViewerWidget::ShowTree()
+{
+    if (!_Table.IsValid())
+    {
+        return;
+    }
+    _Table.Reset();
+    RefreshTable();
+}
+
+TArray<FString> UJsonTreeViewerWidget::GetTableColumns() const
+{
+    TArray<FString> Columns;
+    if (_Table.IsValid())
+    {
+        const FJsonTreeTable& Table = _Table->GetTable();
+        for (int32 Column = 0; Column < Table.NumColumns(); ++Column)
+        {
+            Columns.Add(Table.GetColumnName(Column));
+        }
+    }
+    return Columns;
+}
+
+bool UJsonTreeViewerWidget::SortTable(const FString& Column, bool bDescending)
+{
+    const int32 Index = _Table.IsValid() ? _Table->GetTable().FindColumn(Column) : INDEX_NONE;
+    if (Index == INDEX_NONE)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("The table has no column \"%s\""), *Column);
+        return false;
+    }
+    return SortTableBy(Index, bDescending);
+}
+
+bool UJsonTreeViewerWidget::GetTableColumnSummary(const FString& Column, FJsonTreeColumnSummary& Summary) const
+{
+    Summary = FJsonTreeColumnSummary();
+    const int32 Index = _Table.IsValid() ? _Table->GetTable().FindColumn(Column) : INDEX_NONE;
+    return Index != INDEX_NONE && _Table->GetTable().Summarize(Index, Summary);
+}
+
+bool UJsonTreeViewerWidget::SortTableBy(int32 Column, bool bDescending)
+{
+    if (!_Table->Sort(Column, bDescending))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Column \"%s\" holds values of several types, which can't be sorted"), *_Table->GetTable().GetColumnName(Column));
+        return false;
+    }
+    if (_TableView.IsValid())
+    {
+        _TableView->RequestListRefresh();
+    }
+    return true;
+}
+
+void UJsonTreeViewerWidget::RefreshTable()
+{
+    if (!_TableView.IsValid())
+    {
+        return;
+    }
+
+    _TableHeader->ClearColumns();
+    if (_Table.IsValid())
+    {
+        const FJsonTreeTable& Table = _Table->GetTable();
+        for (int32 Column = 0; Column < Table.NumColumns(); ++Column)
+        {
+            SHeaderRow::FColumn::FArguments ColumnArgs = SHeaderRow::Column(FName(TEXT("Column"), Column + 1))
+                .DefaultLabel(FText::FromString(Table.GetColumnName(Column)))
+                .FillWidth(1.f)
+                .SortMode_UObject(this, &UJsonTreeViewerWidget::GetTableSortMode, Column);
+
+            // Values of several types have no order, so their header doesn't sort
+            if (Table.GetColumnType(Column) != EJsonTreeColumnType::Mixed)
+            {
+                ColumnArgs.OnSort_UObject(this, &UJsonTreeViewerWidget::HandleTableSort);
+            }
+            _TableHeader->AddColumn(ColumnArgs);
+        }
+    }
+
+    _TableView->SetItemsSource(_Table.IsValid() ? &_Table->GetItems() : &NoTableRows);
+    _TableView->SetVisibility(_Table.IsValid() ? EVisibility::Visible : EVisibility::Collapsed);
+    _TreeView->SetVisibility(_Table.IsValid() ? EVisibility::Collapsed : EVisibility::Visible);
+    _TableView->RebuildList();
+}
+
+TSharedRef<ITableRow> UJsonTreeViewerWidget::GenerateTableRow(const int32* Row, const TSharedRef<STableViewBase>& OwnerTable)
+{
+    FJsonTreeViewerStats::AddRowGenerated();
+    return SNew(SJsonTreeTableRow, OwnerTable)
+        .OnGenerateCell_UObject(this, &UJsonTreeViewerWidget::GenerateTableCell, *Row);
+}
+
+TSharedRef<SWidget> UJsonTreeViewerWidget::GenerateTableCell(const FName& ColumnId, int32 Row)
+{
+    // Rows still in the list while the header changes can be asked for columns of a table that is gone
+    const int32 Column = ColumnId.GetNumber() - 1;
+    if (!_Table.IsValid() || Column < 0 || Column >= _Table->GetTable().NumColumns() || Row >= _Table->GetTable().NumRows())
+    {
+        return SNullWidget::NullWidget;
+    }
+
+    const FJsonTreeTable& Table = _Table->GetTable();
+    return SNew(SBox)
+        .HeightOverride(RowHeight > 0.f ? FOptionalSize(RowHeight) : FOptionalSize())
+        .VAlign(VAlign_Center)
+        [
+            SNew(SJsonTreeRow)
+                .ValueText(FText::FromString(Table.GetCellString(Column, Row, MaxValueChars)))
+                .ValueColor(GetValueColorFromJsonType(Table.GetCellType(Column, Row)))
+                .Font(_RowFont)
+                .Padding(Padding)
+        ];
+}
+
+EColumnSortMode::Type UJsonTreeViewerWidget::GetTableSortMode(int32 Column) const
+{
+    if (!_Table.IsValid() || Column != _Table->GetSortColumn())
+    {
+        return EColumnSortMode::None;
+    }
+    return _Table->IsSortDescending() ? EColumnSortMode::Descending : EColumnSortMode::Ascending;
+}
+
+void UJsonTreeViewerWidget::HandleTableSort(EColumnSortPriority::Type Priority, const FName& ColumnId, EColumnSortMode::Type SortMode)
+{
+    SortTableBy(ColumnId.GetNumber() - 1, SortMode == EColumnSortMode::Descending);
+}
+
+void UJsonTreeViewerWidget::HandleSearchTextChanged(const FText& Text)
+{
+    if (!Text.ToString().Equals(_Search->GetQuery(), ESearchCase::CaseSensitive))
+    {
+        Search(Text.ToString());
+    }
+}
+
+void UJsonTreeViewerWidget::HandleSearchTextCommitted(const FText& Text, ETextCommit::Type CommitType)
+{
+    if (CommitType == ETextCommit::OnEnter)
+    {
+        ShowNextSearchResult();
+    }
+}
+
+bool UJsonTreeViewerWidget::LoadJsonTree(const FString& JsonPathOrString, const FJsonTreeLoadOptions& Options, FJsonTreeLoadResult& OutResult, TFunctionRef<bool(float)> OnProgress)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("UJsonTreeViewerWidget::LoadJsonTree");
+
+    // A tree that goes into the document cache is built in full as a read-only document; any other
+    // is the widget's own and may keep lazy children
+    if (Options.bUseDocumentCache)
+    {
+        const TSharedPtr<FJsonTreeDocument> Document = FJsonTreeDocument::Load(JsonPathOrString, Options, OnProgress, OutResult.Error, OutResult.ErrorLine, OutResult.ErrorColumn);
+        if (!Document.IsValid())
+        {
+            // An empty error means the load was aborted
+            return !OutResult.Error.IsEmpty();
+        }
+        FillFromLoadedDocument(JsonPathOrString, Options, Document.ToSharedRef(), OutResult);
+    }
+    else
+    {
+        FJsonTreeDocument::FLoadedTree Tree;
+        if (!FJsonTreeDocument::LoadTree(JsonPathOrString, Options, OnProgress, Tree, OutResult.Error, OutResult.ErrorLine, OutResult.ErrorColumn))
+        {
+            return !OutResult.Error.IsEmpty();
+        }
+        FillFromLoadedTree(JsonPathOrString, Options, Tree, OutResult);
+    }
+
+    return OnProgress(1.f);
+}
+
+TSharedRef<ITableRow> UJsonTreeViewerWidget::GenerateRow(const FJsonTreeNode* Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("UJsonTreeViewerWidget::GenerateRow");
+    FJsonTreeViewerStats::AddRowGenerated();
+
+    // Create the treeview row widget
+    return SNew(STableRow<const FJsonTreeNode*>, OwnerTable)
+        [
+            MakeRowContent(*Item)
+        ];
+}
+
+TSharedRef<SWidget> UJsonTreeViewerWidget::MakeRowContent(const FJsonTreeNode& Item)
+{
+    const FJsonTreeRowText& RowText = GetRowText(Item);
+    const FSlateColor RowKeyColor = Item.IsMore() ? FSlateColor::UseSubduedForeground() : Item.HasAtKey() ? KeyAtColor : KeyColor; // '@' keys get special color
+    const FSlateColor RowValueColor = GetValueColorFromJsonType(Item.GetType()); // Color based on value type
+
+    // Painting the text directly is much cheaper than three text widgets; selectable text needs the
+    // widgets, but those would take the click that reveals the rest of a row
+    TSharedRef<SWidget> Content = bSelectableText && !RowText.bTruncated && !Item.IsMore()
+        ? MakeSelectableRowContent(RowText, RowKeyColor, RowValueColor)
+        : StaticCastSharedRef<SWidget>(SNew(SJsonTreeRow)
+            .KeyText(RowText.Key)
+            .ValueText(RowText.Value)
+            .KeyColor(RowKeyColor)
+            .ValueColor(RowValueColor)
+            .Font(_RowFont)
+            .Padding(Padding)
+            .HighlightText(_Search->GetHighlight())
+            .HighlightColor(SearchHighlightColor));
+
+    return SNew(SBox)
+        .HeightOverride(RowHeight > 0.f ? FOptionalSize(RowHeight) : FOptionalSize())
+        .VAlign(VAlign_Center)
+        [
+            Content
+        ];
+}
+
+TSharedRef<SWidget> UJsonTreeViewerWidget::MakeSelectableRowContent(const FJsonTreeRowText& RowText, const FSlateColor& RowKeyColor, const FSlateColor& RowValueColor)
+{
+    static const FText ColonText = FText::AsCultureInvariant(TEXT(":"));
+
+    return SNew(SHorizontalBox)
+        + SHorizontalBox::Slot()
+        .Padding(Padding)
+        .AutoWidth()
+        [
+            SNew(SEditableText)
+                .IsReadOnly(true)
+                .Visibility(RowText.Key.IsEmpty() ? EVisibility::Collapsed : EVisibility::Visible)
+                .Text(RowText.Key)
+                .SearchText(_Search->GetHighlight())
+                .ColorAndOpacity(RowKeyColor)
+                .Font(_RowFont)
+        ]
+        + SHorizontalBox::Slot()
+        .Padding(Padding)
+        .AutoWidth()
+        [
+            SNew(STextBlock)
+                .Visibility(RowText.Key.IsEmpty() ? EVisibility::Collapsed : EVisibility::Visible)
+                .Text(ColonText)
+                .Font(_RowFont)
+        ]
+        + SHorizontalBox::Slot()
+        .Padding(Padding)
+        .AutoWidth()
+        [
+            SNew(SEditableText)
+                .IsReadOnly(true)
+                .Visibility(RowText.Value.IsEmpty() ? EVisibility::Collapsed : EVisibility::Visible)
+                .Text(RowText.Value)
+                .SearchText(_Search->GetHighlight())
+                .ColorAndOpacity(RowValueColor)
+                .Font(_RowFont)
+        ];
+}
+
+const FJsonTreeRowText& UJsonTreeViewerWidget::GetRowText(const FJsonTreeNode& Item)
+{
+    if (const FJsonTreeRowText* Cached = _RowTextCache.Find(&Item))
+    {
+        return *Cached;
+    }
+
+    if (_RowTextCache.Num() >= MaxCachedRowTexts)
+    {
+        _RowTextCache.Reset();
+    }
+
+    // The pool holds UTF-8 and numbers are native; only rows that are actually generated pay for
+    // the conversion and for formatting numbers
+    FJsonTreeRowText& RowText = _RowTextCache.Add(&Item);
+    if (Item.IsMore())
+    {
+        RowText.Key = FText::FromString(FString::Printf(TEXT("\u2026 %s more"), *FText::AsNumber(Item.Key).ToString()));
+        return RowText;
+    }
+
+    RowText.Key = FText::FromString(_NodeStore->GetKeyString(Item));
+    if (MaxValueChars > 0 && !_RevealedValues.Contains(&Item))
+    {
+        // A huge value would be converted and measured whole just to show its first screenful
+        int64 HiddenBytes = 0;
+        FString Value = _NodeStore->GetValueString(Item, MaxValueChars, HiddenBytes);
+        if (HiddenBytes > 0)
+        {
+            Value += FString::Printf(TEXT("\u2026 (%s more)"), *FText::AsMemory(uint64(HiddenBytes)).ToString());
+            RowText.bTruncated = true;
+        }
+        RowText.Value = FText::FromString(MoveTemp(Value));
+    }
+    else
+    {
+        RowText.Value = FText::FromString(_NodeStore->GetValueString(Item));
+    }
+    return RowText;
+}
+
+void UJsonTreeViewerWidget::GetChildren(const FJsonTreeNode* Item, TArray<const FJsonTreeNode*>& OutChildren)
+{
+    JSONTREEVIEWER_TRACE_SCOPE("UJsonTreeViewerWidget::GetChildren");
+    FJsonTreeViewerStats::AddGetChildrenCall();
+
+    // Lazily parsed items get their children the first time the tree asks for them
+    MaterializeChildren(*Item);
+
+    // The tree asks for the children of every item it lists, but for a collapsed item it only
+    // checks whether there are any; one child is enough for that, whatever the fan-out
+    if (!_TreeView.IsValid() || !_TreeView->IsItemExpanded(Item))
+    {
+        if (IsFilteredItem(*Item))
+        {
+            GetAppliedFilter()->GetChildren(*_NodeStore, *Item, OutChildren, 1, false);
+        }
+        else
+        {
+            _NodeStore->GetChildren(*Item, OutChildren, 1);
+        }
+        return;
+    }
+
+    // An expanded item is asked again on every refresh of the tree, and copies the list it built the first time
+    _ChildLists->GetChildren(*_NodeStore, *Item, IsFilteredItem(*Item) ? GetAppliedFilter() : nullptr, MaxShownChildren, OutChildren);
+}
+
+void UJsonTreeViewerWidget::MaterializeChildren(const FJsonTreeNode& Item)
+{
+    if (Item.HasPendingChildren() && _OwnedStore.IsValid())
+    {
+        _OwnedStore->MaterializeChildren(Item.Container.Self);
+        _LoadStats.Nodes = _OwnedStore->Num();
+    }
+}
+
+uint32 UJsonTreeViewerWidget::GetNumShownChildren(const FJsonTreeNode& Item) const
+{
+    return _ChildLists->GetNumShown(Item, MaxShownChildren);
+}
+
+void UJsonTreeViewerWidget::ShowMoreChildren(const FJsonTreeNode& Item, uint32 NumShown)
+{
+    // The "... N more" row keeps its item, so its widget is only rebuilt with the new count by a full rebuild
+    if (const FJsonTreeNode* More = _ChildLists->ShowMore(Item, NumShown))
+    {
+        _RowTextCache.Remove(More);
+    }
+    if (_TreeView.IsValid())
+    {
+        _TreeView->RebuildList();
+    }
+}
+
+void UJsonTreeViewerWidget::HandleExpansionChanged(const FJsonTreeNode* Item, bool bExpanded)
+{
+    if (!bExpanded)
+    {
+        _ChildLists->Forget(*Item);
+    }
+}
+
+void UJsonTreeViewerWidget::HandleSetExpansionRecursive(const FJsonTreeNode* Item, bool bExpand)
+{
+    if (!_TreeView.IsValid() || !_NodeStore.IsValid())
+    {
+        return;
+    }
+
+    if (bExpand)
+    {
+        // STreeView's own walk asks for every descendant's children, so a shift-click on a large
+        // container would build and list all of it; this one follows the store under the same
+        // MaxExpandedItems budget as ExpandAll
+        _TreeView->SetItemExpansion(Item, true);
+        ExpandDescendants(MakeArrayView(&Item, 1), MAX_int32);
+        return;
+    }
+
+    // Collapsing drops the expansion of every descendant too, found through their parent links
+    TSet<const FJsonTreeNode*> Expanded;
+    _TreeView->GetExpandedItems(Expanded);
+    for (const FJsonTreeNode* Other : Expanded)
+    {
+        for (const FJsonTreeNode* Ancestor = Other; ; Ancestor = &_NodeStore->GetNode(Ancestor->Parent))
+        {
+            if (Ancestor == Item)
+            {
+                _TreeView->SetItemExpansion(Other, false);
+                break;
+            }
+            if (Ancestor->Parent == FJsonTreeNodeStore::InvalidIndex)
+            {
+                break;
+            }
+        }
+    }
+    _TreeView->RequestTreeRefresh();
+}
+
+void UJsonTreeViewerWidget::HandleItemClicked(const FJsonTreeNode* Item)
+{
+    if (Item->IsMore())
+    {
+        const FJsonTreeNode& Parent = _NodeStore->GetNode(Item->Parent);
+        ShowMoreChildren(Parent, GetNumShownChildren(Parent) + uint32(MaxShownChildren));
+        return;
+    }
+
+    if (GetRowText(*Item).bTruncated)
+    {
+        _RevealedValues.Add(Item);
+        _RowTextCache.Remove(Item);
+        if (_TreeView.IsValid())
+        {
+            _TreeView->RebuildList();
+        }
+    }
+}
+
+void UJsonTreeViewerWidget::ResetRowTexts()
+{
+    _RowTextCache.Reset();
+    _RevealedValues.Reset();
+    _ChildLists->Reset();
+}
+
+int64 UJsonTreeViewerWidget::GetMemoryFootprint() const
+{
+    SIZE_T Bytes = JsonInput.GetAllocatedSize() + _TreeItems.GetAllocatedSize() + _RowTextCache.GetAllocatedSize()
+        + _RevealedValues.GetAllocatedSize() + _ChildLists->GetAllocatedSize();
+
+    // The tree and text of a shared document are counted once, by the document; a mapped file is
+    // backed by the file itself rather than by memory
+    if (!_Document.IsValid())
+    {
+        if (_JsonSource.IsValid() && !_JsonSource->IsMapped())
+        {
+            Bytes += _JsonSource->Num();
+        }
+        if (_NodeStore.IsValid())
+        {
+            Bytes += _NodeStore->GetAllocatedSize();
+        }
+    }
+    if (_JsonValue.IsValid())
+    {
+        Bytes += GetJsonValueSize(_JsonValue);
+    }
+
+    // An index handed to the document is shared with the other widgets showing it. One of the
+    // widget's own keeps its text alive, which is counted here unless it is counted above.
+    const TSharedPtr<FJsonTreeSearchIndex, ESPMode::ThreadSafe>& Index = _Search->GetIndex();
+    const bool bSharedIndex = _Document.IsValid() && _Document->GetSearchIndex() == Index;
+    Bytes += _Search->GetAllocatedSize(!bSharedIndex);
+    if (Index.IsValid() && !bSharedIndex && !_Document.IsValid() && Index->GetSource() != _JsonSource && !Index->GetSource()->IsMapped())
+    {
+        Bytes += Index->GetSource()->Num();
+    }
+    if (_FilterView.IsValid())
+    {
+        Bytes += _FilterView->GetAllocatedSize();
+    }
+    if (_Table.IsValid())
+    {
+        Bytes += _Table->GetAllocatedSize();
+    }
+    return int64(Bytes);
+}
+
+int64 UJsonTreeViewerWidget::GetSharedMemoryFootprint() const
+{
+    return _Document.IsValid() ? int64(_Document->GetAllocatedSize()) : 0;
+}
+
+FString UJsonTreeViewerWidget::GetLoadError(int32& Line, int32& Column) const
+{
+    Line = _LoadErrorLine;
+    Column = _LoadErrorColumn;
+    return _LoadError;
+}
+
+TSharedPtr<FJsonValue> UJsonTreeViewerWidget::GetJsonValue()
+{
+    if (_JsonValue.IsValid() || !_JsonSource.IsValid())
+    {
+        return _JsonValue;
+    }
+
+    // The tree doesn't need a DOM, so one is only deserialized when somebody asks for it
+    JSONTREEVIEWER_TRACE_SCOPE("UJsonTreeViewerWidget::GetJsonValue");
+    if (_JsonSource->Num() > MAX_int32)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("The document is too large for an FJsonValue"));
+        return nullptr;
+    }
+
+    // The string is sized by the converted length and converted into in one go, so the only
+    // TCHAR copy of the text is the one the reader takes over
+    FString JsonText(int32(_JsonSource->Num()), reinterpret_cast<const UTF8CHAR*>(_JsonSource->GetData()));
+    TSharedPtr<FJsonValue> JsonValue;
+    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(MoveTemp(JsonText));
+    if (!FJsonSerializer::Deserialize(JsonReader, JsonValue))
+    {
+        return nullptr;
+    }
+
+    if (RetainSource == EJsonTreeRetainSource::Dom)
+    {
+        _JsonValue = JsonValue;
+    }
+    return JsonValue;
 }
 
 FSlateColor UJsonTreeViewerWidget::GetValueColorFromJsonType(EJson Type)
@@ -0,0 +1,131 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "SJsonTreeRow.h"
+#include "Fonts/FontMeasure.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+
+void SJsonTreeRow::Construct(const FArguments& InArgs)
+{
+    Font = InArgs._Font;
+    Padding = InArgs._Padding;
+    HighlightColor = InArgs._HighlightColor;
+
+    static const FText ColonText = FText::AsCultureInvariant(TEXT(":"));
+    if (!InArgs._KeyText.IsEmpty())
+    {
+        Runs.Add({ InArgs._KeyText, InArgs._KeyColor });
+        Runs.Add({ ColonText, FSlateColor::UseForeground() });
+    }
+    if (!InArgs._ValueText.IsEmpty())
+    {
+        Runs.Add({ InArgs._ValueText, InArgs._ValueColor });
+    }
+
+    // Rows are immutable, so the runs are measured once and laid out left to right
+    const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+    float Offset = 0.f;
+    float Height = 0.f;
+    for (FRun& Run : Runs)
+    {
+        Run.Size = FontMeasure->Measure(Run.Text, Font);
+        Run.Offset = Offset + Padding.Left;
+        Offset = Run.Offset + Run.Size.X + Padding.Right;
+        Height = FMath::Max(Height, float(Run.Size.Y));
+    }
+    ContentSize = FVector2D(Offset, Height + Padding.GetTotalSpaceAlong<Orient_Vertical>());
+
+    const FString Highlight = InArgs._HighlightText.ToString();
+    if (!Highlight.IsEmpty())
+    {
+        for (const FRun& Run : Runs)
+        {
+            AddHighlights(Run, Highlight, *FontMeasure);
+        }
+    }
+}
+
+void SJsonTreeRow::AddHighlights(const FRun& Run, const FString& Highlight, const FSlateFontMeasure& FontMeasure)
+{
+    const FString& Text = Run.Text.ToString();
+    for (int32 Start = Text.Find(Highlight, ESearchCase::IgnoreCase); Start != INDEX_NONE;
+        Start = Text.Find(Highlight, ESearchCase::IgnoreCase, ESearchDir::FromStart, Start + Highlight.Len()))
+    {
+        FHighlight& Mark = Highlights.AddDefaulted_GetRef();
+        Mark.Offset = Run.Offset + float(FontMeasure.Measure(Text.Left(Start), Font).X);
+        Mark.Width = float(FontMeasure.Measure(Text.Mid(Start, Highlight.Len()), Font).X);
+    }
+}
+
+FVector2D SJsonTreeRow::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+    return ContentSize;
+}
+
+int32 SJsonTreeRow::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+    FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+    const ESlateDrawEffect DrawEffects = ShouldBeEnabled(bParentEnabled) ? ESlateDrawEffect::None : ESlateDrawEffect::DisabledEffect;
+
+    // Search matches are marked behind the text
+    if (Highlights.Num() > 0)
+    {
+        const FSlateBrush* Brush = FCoreStyle::Get().GetBrush("GenericWhiteBox");
+        const FLinearColor Color = HighlightColor.GetColor(InWidgetStyle);
+        const float Height = ContentSize.Y - Padding.GetTotalSpaceAlong<Orient_Vertical>();
+        for (const FHighlight& Mark : Highlights)
+        {
+            const FVector2f Position(Mark.Offset, (AllottedGeometry.GetLocalSize().Y - Height) * 0.5f);
+            FSlateDrawElement::MakeBox(
+                OutDrawElements,
+                LayerId,
+                AllottedGeometry.ToPaintGeometry(FVector2f(Mark.Width, Height), FSlateLayoutTransform(Position)),
+                Brush,
+                DrawEffects,
+                Color);
+        }
+        ++LayerId;
+    }
+
+    for (const FRun& Run : Runs)
+    {
+        // Centre each run vertically so rows with a fixed RowHeight still line up
+        const FVector2f Position(Run.Offset, (AllottedGeometry.GetLocalSize().Y - float(Run.Size.Y)) * 0.5f);
+        FSlateDrawElement::MakeText(
+            OutDrawElements,
+            LayerId,
+            AllottedGeometry.ToPaintGeometry(FVector2f(Run.Size), FSlateLayoutTransform(Position)),
+            Run.Text,
+            Font,
+            DrawEffects,
+            Run.Color.GetColor(InWidgetStyle) * InWidgetStyle.GetColorAndOpacityTint());
+    }
+
+    return LayerId;
+}
@@ -0,0 +1,97 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+
+class FSlateFontMeasure;
+
+/**
+ * SJsonTreeRow
+ *
+ * Read-only content of one tree row. Key, colon and value are painted directly as three colored
+ * text runs, instead of being laid out as separate text widgets.
+ */
+class SJsonTreeRow : public SLeafWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SJsonTreeRow)
+        : _KeyColor(FSlateColor::UseForeground())
+        , _ValueColor(FSlateColor::UseForeground())
+        , _Padding(FMargin(0.f))
+        , _HighlightColor(FLinearColor(1.f, 1.f, 0.f, 0.35f))
+    {}
+        // Member name; the key and colon are omitted when empty
+        SLATE_ARGUMENT(FText, KeyText)
+        SLATE_ARGUMENT(FText, ValueText)
+        SLATE_ARGUMENT(FSlateColor, KeyColor)
+        SLATE_ARGUMENT(FSlateColor, ValueColor)
+        SLATE_ARGUMENT(FSlateFontInfo, Font)
+        // Space around each of the three runs
+        SLATE_ARGUMENT(FMargin, Padding)
+        // Text marked wherever it occurs in the key or value, ignoring case
+        SLATE_ARGUMENT(FText, HighlightText)
+        SLATE_ARGUMENT(FSlateColor, HighlightColor)
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs);
+
+    virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+        FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+protected:
+    virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+private:
+    // One piece of text and where it sits in the row
+    struct FRun
+    {
+        FText Text;
+        FSlateColor Color;
+        float Offset = 0.f;
+        FVector2D Size = FVector2D::ZeroVector;
+    };
+
+    // Horizontal extent of one occurrence of the highlight text
+    struct FHighlight
+    {
+        float Offset = 0.f;
+        float Width = 0.f;
+    };
+
+    // Find the occurrences of Highlight in a run and measure where they sit
+    void AddHighlights(const FRun& Run, const FString& Highlight, const FSlateFontMeasure& FontMeasure);
+
+    TArray<FRun, TInlineAllocator<3>> Runs;
+    TArray<FHighlight> Highlights;
+    FSlateColor HighlightColor;
+    FSlateFontInfo Font;
+    FMargin Padding;
+    FVector2D ContentSize;
+};
@@ -0,0 +1,54 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/Views/STableRow.h"
+
+/**
+ * SJsonTreeTableRow
+ *
+ * One row of the table view. Each cell is asked of the owner as the header row lists its column.
+ */
+class SJsonTreeTableRow : public SMultiColumnTableRow<const int32*>
+{
+public:
+    DECLARE_DELEGATE_RetVal_OneParam(TSharedRef<SWidget>, FOnGenerateCell, const FName& /*ColumnId*/);
+
+    SLATE_BEGIN_ARGS(SJsonTreeTableRow) {}
+        // Content of the cell in a column
+        SLATE_EVENT(FOnGenerateCell, OnGenerateCell)
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable);
+
+    virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnId) override;
+
+private:
+    FOnGenerateCell OnGenerateCell;
+};
@@ -0,0 +1,89 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "JsonTreeTestHelpers.h"
+#include "JsonTreeLocation.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonTreeLocationPointerTest, "JsonTreeViewer.Location.Pointer", JSONTREEVIEWER_TEST_FLAGS)
+
+bool FJsonTreeLocationPointerTest::RunTest(const FString& Parameters)
+{
+    struct FCase
+    {
+        const TCHAR* Path;
+        TArray<FString> Tokens;
+    };
+    const FCase Cases[] =
+    {
+        { TEXT(""), {} },                                                  // The whole document
+        { TEXT("/"), { TEXT("") } },                                       // The member with the empty name
+        { TEXT("/a/0/b"), { TEXT("a"), TEXT("0"), TEXT("b") } },
+        { TEXT("/a~1b/m~0n"), { TEXT("a/b"), TEXT("m~n") } },
+        { TEXT("/~01"), { TEXT("~1") } },                                  // ~0 is decoded last, so it never makes a ~1
+        { TEXT("/~10"), { TEXT("/0") } },
+        { TEXT("//x/"), { TEXT(""), TEXT("x"), TEXT("") } },
+        { TEXT("$"), {} },
+        { TEXT("$.a[2].b"), { TEXT("a"), TEXT("2"), TEXT("b") } },
+        { TEXT("$['a.b'][\"c\\\"d\"][0]"), { TEXT("a.b"), TEXT("c\"d"), TEXT("0") } },
+    };
+    for (const FCase& Case : Cases)
+    {
+        TArray<FString> Tokens;
+        TestTrue(*FString::Printf(TEXT("%s parses"), Case.Path), FJsonTreeLocation::Parse(Case.Path, Tokens));
+        TestEqual(*FString::Printf(TEXT("%s tokens"), Case.Path), Tokens, Case.Tokens);
+    }
+
+    // Wildcards, recursive descent and anything that is neither form are refused
+    for (const TCHAR* Path : { TEXT("a/b"), TEXT("$..a"), TEXT("$.*"), TEXT("$[*]"), TEXT("$.a["), TEXT("$['a'"), TEXT("$[-1]") })
+    {
+        TArray<FString> Tokens;
+        TestFalse(*FString::Printf(TEXT("%s is refused"), Path), FJsonTreeLocation::Parse(Path, Tokens));
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonTreeLocationArrayIndexTest, "JsonTreeViewer.Location.ArrayIndex", JSONTREEVIEWER_TEST_FLAGS)
+
+bool FJsonTreeLocationArrayIndexTest::RunTest(const FString& Parameters)
+{
+    uint32 Index = 0;
+    TestTrue(TEXT("0 is an index"), FJsonTreeLocation::ParseArrayIndex(TEXT("0"), Index) && Index == 0);
+    TestTrue(TEXT("1234 is an index"), FJsonTreeLocation::ParseArrayIndex(TEXT("1234"), Index) && Index == 1234);
+
+    // Indices past the last one any array can have still parse, so the lookup reports them missing
+    TestTrue(TEXT("Ten digits clamp"), FJsonTreeLocation::ParseArrayIndex(TEXT("9999999999"), Index) && Index == MAX_uint32);
+
+    for (const TCHAR* Token : { TEXT(""), TEXT("01"), TEXT("-1"), TEXT("1a"), TEXT("+1"), TEXT("12345678901") })
+    {
+        TestFalse(*FString::Printf(TEXT("\"%s\" isn't an index"), Token), FJsonTreeLocation::ParseArrayIndex(Token, Index));
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
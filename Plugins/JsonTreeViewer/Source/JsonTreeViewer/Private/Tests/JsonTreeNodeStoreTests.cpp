@@ -0,0 +1,315 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "JsonTreeTestHelpers.h"
+#include "JsonTreeFilterView.h"
+#include "JsonTreeSnapshot.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonTreeNodeStorePatchTest, "JsonTreeViewer.NodeStore.Patch", JSONTREEVIEWER_TEST_FLAGS)
+
+bool FJsonTreeNodeStorePatchTest::RunTest(const FString& Parameters)
+{
+    const TCHAR* const OldJson = TEXT(R"({"a":1,"b":{"x":1,"y":[1,2,3]},"c":"s","d":[{"k":1},{"k":2}]})");
+    const TCHAR* const NewJson = TEXT(R"({"a":2,"b":{"x":1,"y":[1,5,3,4]},"c":"s","d":[{"k":2}],"e":{"f":null}})");
+
+    for (const bool bLazy : { false, true })
+    {
+        FJsonTreeNodeStore Store;
+        FJsonTreeNodeStore Update;
+        FJsonTreeNodeStore Expected;
+        JsonTreeTests::BuildStore(Store, OldJson, bLazy);
+        JsonTreeTests::BuildStore(Update, NewJson, bLazy);
+        JsonTreeTests::BuildStore(Expected, NewJson);
+
+        // Expanding builds the lazy children the tree holds pointers to
+        JsonTreeTests::DescribeTree(Store);
+        const FJsonTreeNode* A = &Store.GetNode(JsonTreeTests::FindMember(Store, 0, "a"));
+        const FJsonTreeNode* B = &Store.GetNode(JsonTreeTests::FindMember(Store, 0, "b"));
+        const FJsonTreeNode* X = &Store.GetNode(JsonTreeTests::FindMember(Store, B->Container.Self, "x"));
+        const FJsonTreeNode* C = &Store.GetNode(JsonTreeTests::FindMember(Store, 0, "c"));
+        const FJsonTreeNode* Y = &Store.GetNode(JsonTreeTests::FindMember(Store, B->Container.Self, "y"));
+        const FJsonTreeNode* Y1 = &Store.GetNode(Store.GetElement(Y->Container.Self, 1));
+
+        FJsonTreePatchResult Result;
+        FString Error;
+        TestTrue(TEXT("Patch succeeds"), Store.Patch(Update, Result, Error));
+        TestEqual(TEXT("Patched tree matches the new document"), JsonTreeTests::DescribeTree(Store), JsonTreeTests::DescribeTree(Expected));
+        TestTrue(TEXT("Child lists changed"), Result.bStructureChanged);
+
+        // Nodes at the same path keep their address, whether or not their value changed
+        TestTrue(TEXT("a keeps its node"), &Store.GetNode(JsonTreeTests::FindMember(Store, 0, "a")) == A);
+        TestTrue(TEXT("b.x keeps its node"), &Store.GetNode(JsonTreeTests::FindMember(Store, B->Container.Self, "x")) == X);
+        TestTrue(TEXT("b.y[1] keeps its node"), &Store.GetNode(Store.GetElement(Y->Container.Self, 1)) == Y1);
+        TestTrue(TEXT("Changed values are reported"), Result.ChangedNodes.Contains(A) && Result.ChangedNodes.Contains(Y1));
+        TestFalse(TEXT("Unchanged values aren't reported"), Result.ChangedNodes.Contains(X) || Result.ChangedNodes.Contains(C));
+        TestTrue(TEXT("Removed elements are marked dead"), Store.GetNumDeadNodes() > 0);
+
+        // A second patch with the same document changes nothing
+        FJsonTreeNodeStore Same;
+        JsonTreeTests::BuildStore(Same, NewJson, bLazy);
+        FJsonTreePatchResult SameResult;
+        TestTrue(TEXT("Repatch succeeds"), Store.Patch(Same, SameResult, Error));
+        TestFalse(TEXT("Repatching changes no child list"), SameResult.bStructureChanged);
+        TestEqual(TEXT("Repatching changes no value"), SameResult.ChangedNodes.Num(), 0);
+    }
+
+    // Members that repeat a name are matched by occurrence, so the second "a" stays the second one
+    FJsonTreeNodeStore Repeated;
+    FJsonTreeNodeStore RepeatedUpdate;
+    FJsonTreeNodeStore RepeatedExpected;
+    JsonTreeTests::BuildStore(Repeated, TEXT(R"({"a":1,"a":2})"));
+    JsonTreeTests::BuildStore(RepeatedUpdate, TEXT(R"({"a":1,"b":0,"a":3})"));
+    JsonTreeTests::BuildStore(RepeatedExpected, TEXT(R"({"a":1,"b":0,"a":3})"));
+    TArray<const FJsonTreeNode*> Before;
+    Repeated.GetTopLevelItems(Before);
+    FJsonTreePatchResult RepeatedResult;
+    FString Error;
+    TestTrue(TEXT("Repeated names patch succeeds"), Repeated.Patch(RepeatedUpdate, RepeatedResult, Error));
+    TArray<const FJsonTreeNode*> After;
+    Repeated.GetTopLevelItems(After);
+    TestEqual(TEXT("Repeated names patch"), JsonTreeTests::DescribeTree(Repeated), JsonTreeTests::DescribeTree(RepeatedExpected));
+    TestTrue(TEXT("Each occurrence keeps its node"), After.Num() == 3 && After[0] == Before[0] && After[2] == Before[1]);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonTreeNodeStoreCompactTest, "JsonTreeViewer.NodeStore.Compact", JSONTREEVIEWER_TEST_FLAGS)
+
+bool FJsonTreeNodeStoreCompactTest::RunTest(const FString& Parameters)
+{
+    FJsonTreeNodeStore Store;
+    FJsonTreeNodeStore Update;
+    JsonTreeTests::BuildStore(Store, TEXT(R"({"keep":{"v":"old text","w":[1,2]},"drop":[1,2,3,{"deep":true}]})"));
+    JsonTreeTests::BuildStore(Update, TEXT(R"({"keep":{"v":"new text","w":[1,2]}})"));
+    FJsonTreePatchResult Result;
+    FString Error;
+    TestTrue(TEXT("Patch succeeds"), Store.Patch(Update, Result, Error));
+    const FString Expected = JsonTreeTests::DescribeTree(Store);
+    const int32 NumBefore = Store.Num();
+    const uint32 NumDead = Store.GetNumDeadNodes();
+    const uint32 OldKeep = JsonTreeTests::FindMember(Store, 0, "keep");
+    if (!TestTrue(TEXT("Patch left dead nodes"), NumDead > 0))
+    {
+        return false;
+    }
+
+    TArray<uint32> Remap;
+    Store.Compact(Remap);
+    TestEqual(TEXT("No dead nodes are left"), Store.GetNumDeadNodes(), uint32(0));
+    TestEqual(TEXT("Only the dead nodes are released"), Store.Num(), NumBefore - int32(NumDead));
+    TestEqual(TEXT("Compaction keeps the tree"), JsonTreeTests::DescribeTree(Store), Expected);
+    TestEqual(TEXT("Remap covers every old node"), Remap.Num(), NumBefore);
+
+    int32 NumRemapped = 0;
+    for (const uint32 NewIndex : Remap)
+    {
+        NumRemapped += NewIndex != FJsonTreeNodeStore::InvalidIndex ? 1 : 0;
+    }
+    TestEqual(TEXT("Every live node is remapped"), NumRemapped, Store.Num());
+    TestEqual(TEXT("Remap follows moved nodes"), Remap[OldKeep], JsonTreeTests::FindMember(Store, 0, "keep"));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonTreeNodeStoreSnapshotTest, "JsonTreeViewer.NodeStore.Snapshot", JSONTREEVIEWER_TEST_FLAGS)
+
+bool FJsonTreeNodeStoreSnapshotTest::RunTest(const FString& Parameters)
+{
+    FString Json = TEXT("{\"name\":\"snapshot\",\"items\":[");
+    for (int32 Index = 0; Index < 2500; ++Index)
+    {
+        Json += FString::Printf(TEXT("%s{\"id\":%d,\"@type\":\"item\",\"v\":%d.25,\"s\":\"t\\u00e9xt %d\",\"n\":null}"), Index > 0 ? TEXT(",") : TEXT(""), Index, Index, Index);
+    }
+    Json += TEXT("],\"big\":-9223372036854775808}");
+
+    const FString FilePath = FPaths::AutomationTransientDir() / TEXT("JsonTreeViewer") / TEXT("Snapshot.json");
+    if (!TestTrue(TEXT("Write the document"), FFileHelper::SaveStringToFile(Json, *FilePath)))
+    {
+        return false;
+    }
+    const TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> Source = FJsonTreeSource::FromFile(FilePath);
+    if (!TestTrue(TEXT("Map the document"), Source.IsValid()))
+    {
+        return false;
+    }
+    const FJsonTreeSnapshotStamp Stamp = FJsonTreeSnapshotStamp::Make(FilePath, *Source);
+
+    FJsonTreeNodeStore Store;
+    FJsonTreeNodeStore Lazy;
+    FString Error;
+    int32 ErrorLine = 0;
+    int32 ErrorColumn = 0;
+    Store.Build(Source.ToSharedRef(), false, false, [](float) { return true; }, Error, ErrorLine, ErrorColumn);
+    Lazy.Build(Source.ToSharedRef(), true, false, [](float) { return true; }, Error, ErrorLine, ErrorColumn);
+
+    TestFalse(TEXT("A lazy store has no snapshot"), FJsonTreeSnapshot::Save(Lazy, FilePath, Stamp));
+    TestTrue(TEXT("Save the snapshot"), FJsonTreeSnapshot::Save(Store, FilePath, Stamp));
+
+    TSharedPtr<FJsonTreeNodeStore> Snapshot = FJsonTreeSnapshot::Load(FilePath, Stamp);
+    if (TestTrue(TEXT("Load the snapshot"), Snapshot.IsValid()))
+    {
+        TestTrue(TEXT("The loaded store reads the snapshot"), Snapshot->IsSnapshot());
+        TestEqual(TEXT("Node count survives"), Snapshot->Num(), Store.Num());
+        TestTrue(TEXT("Every node survives"), JsonTreeTests::DescribeTree(*Snapshot) == JsonTreeTests::DescribeTree(Store));
+        TestTrue(TEXT("Names are looked up in the snapshot"), JsonTreeTests::FindMember(*Snapshot, 0, "big") == JsonTreeTests::FindMember(Store, 0, "big"));
+        const uint32 Items = JsonTreeTests::FindMember(*Snapshot, 0, "items");
+        TestTrue(TEXT("Paged elements are found in the snapshot"), Items != FJsonTreeNodeStore::InvalidIndex && Snapshot->GetElement(Items, 2400) == Store.GetElement(Items, 2400));
+    }
+
+    // Another version of the file doesn't match
+    FJsonTreeSnapshotStamp Stale = Stamp;
+    Stale.SourceTimestamp += 1;
+    TestFalse(TEXT("A stale snapshot isn't loaded"), FJsonTreeSnapshot::Load(FilePath, Stale).IsValid());
+
+    // A sidecar damaged on its own keeps a matching stamp, but is refused rather than read out of bounds
+    Snapshot.Reset();
+    const FString SnapshotPath = FJsonTreeSnapshot::GetPath(FilePath);
+    TArray<uint8> Bytes;
+    if (TestTrue(TEXT("Read the snapshot"), FFileHelper::LoadFileToArray(Bytes, *SnapshotPath)))
+    {
+        const uint32 Items = JsonTreeTests::FindMember(Store, 0, "items");
+        const uint32 Element = Store.GetElement(Items, 10);
+        struct FDamage
+        {
+            const TCHAR* What;
+            uint32 Node;
+            SIZE_T FieldOffset;
+            uint32 Value;
+        };
+        const FDamage Damages[] =
+        {
+            { TEXT("A link past the node table"), Element, STRUCT_OFFSET(FJsonTreeNode, NextSibling), uint32(Store.Num()) + 7 },
+            { TEXT("A node linked twice"), Element, STRUCT_OFFSET(FJsonTreeNode, NextSibling), Store.GetElement(Items, 5) },
+            { TEXT("A child count that doesn't match"), Items, STRUCT_OFFSET(FJsonTreeNode, NumChildren), 4 },
+            { TEXT("Text past the string pool"), JsonTreeTests::FindMember(Store, Element, "s"), STRUCT_OFFSET(FJsonTreeNode, Value) + sizeof(uint32), MAX_uint32 - 1 },
+        };
+        for (const FDamage& Damage : Damages)
+        {
+            // Nodes are written as they are held, on a boundary that is a multiple of their size
+            const FJsonTreeNode& Node = Store.GetNode(Damage.Node);
+            int64 NodeOffset = INDEX_NONE;
+            for (int64 Offset = 0; Offset + int64(sizeof(FJsonTreeNode)) <= Bytes.Num() && NodeOffset == INDEX_NONE; Offset += sizeof(FJsonTreeNode))
+            {
+                NodeOffset = FMemory::Memcmp(Bytes.GetData() + Offset, &Node, sizeof(FJsonTreeNode)) == 0 ? Offset : INDEX_NONE;
+            }
+            if (!TestTrue(*FString::Printf(TEXT("%s: find the node"), Damage.What), NodeOffset != INDEX_NONE))
+            {
+                continue;
+            }
+
+            TArray<uint8> Damaged = Bytes;
+            FMemory::Memcpy(Damaged.GetData() + NodeOffset + Damage.FieldOffset, &Damage.Value, sizeof(uint32));
+            FFileHelper::SaveArrayToFile(Damaged, *SnapshotPath);
+            TestFalse(*FString::Printf(TEXT("%s is refused"), Damage.What), FJsonTreeSnapshot::Load(FilePath, Stamp).IsValid());
+        }
+        FFileHelper::SaveArrayToFile(Bytes, *SnapshotPath);
+        TestTrue(TEXT("The undamaged snapshot loads again"), FJsonTreeSnapshot::Load(FilePath, Stamp).IsValid());
+    }
+
+    IFileManager::Get().Delete(*SnapshotPath);
+    IFileManager::Get().Delete(*FilePath);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonTreeNodeStoreFilterTest, "JsonTreeViewer.NodeStore.Filter", JSONTREEVIEWER_TEST_FLAGS)
+
+bool FJsonTreeNodeStoreFilterTest::RunTest(const FString& Parameters)
+{
+    FJsonTreeNodeStore Store;
+    JsonTreeTests::BuildStore(Store, TEXT(R"({"a":1,"b":{"c":null,"d":2.5},"e":[null,"s"],"Alpha":"x"})"));
+    const uint32 A = JsonTreeTests::FindMember(Store, 0, "a");
+    const uint32 B = JsonTreeTests::FindMember(Store, 0, "b");
+    const uint32 C = JsonTreeTests::FindMember(Store, B, "c");
+    const uint32 D = JsonTreeTests::FindMember(Store, B, "d");
+    const uint32 E = JsonTreeTests::FindMember(Store, 0, "e");
+    const uint32 E0 = Store.GetElement(E, 0);
+    const uint32 E1 = Store.GetElement(E, 1);
+    const uint32 Alpha = JsonTreeTests::FindMember(Store, 0, "Alpha");
+
+    // Bits of the nodes set in a result, as node indices
+    auto SetBits = [](const TBitArray<>& Bits)
+    {
+        TArray<uint32> Indices;
+        for (TConstSetBitIterator<> It(Bits); It; ++It)
+        {
+            Indices.Add(uint32(It.GetIndex()));
+        }
+        return Indices;
+    };
+
+    FJsonTreeNodeFilter Nulls;
+    Nulls.TypeMask = 1u << uint32(EJson::Null);
+    FJsonTreeFilterResult Result;
+    Store.FilterNodes(Nulls, Result);
+    TestEqual(TEXT("Null matches"), Result.NumMatches, 2);
+    TestEqual(TEXT("Null match bits"), SetBits(Result.Matches), TArray<uint32>({ C, E0 }));
+    TestEqual(TEXT("Matches and their ancestors are shown"), SetBits(Result.Shown), TArray<uint32>({ 0, B, C, E, E0 }));
+
+    FJsonTreeNodeFilter Keys;
+    Keys.KeyPattern = TEXT("?");
+    Store.FilterNodes(Keys, Result);
+    TestEqual(TEXT("Single-character names match, elements never do"), SetBits(Result.Matches), TArray<uint32>({ A, B, C, D, E }));
+
+    FJsonTreeNodeFilter Wildcard;
+    Wildcard.KeyPattern = TEXT("al*");
+    Store.FilterNodes(Wildcard, Result);
+    TestEqual(TEXT("Name patterns ignore case"), SetBits(Result.Matches), TArray<uint32>({ Alpha }));
+
+    FJsonTreeNodeFilter Range;
+    Range.bNumberRange = true;
+    Range.MinNumber = 1.5;
+    Range.MaxNumber = 3.0;
+    Store.FilterNodes(Range, Result);
+    TestEqual(TEXT("Number range"), SetBits(Result.Matches), TArray<uint32>({ D }));
+
+    FJsonTreeNodeFilter Strings;
+    Strings.TypeMask = 1u << uint32(EJson::String);
+    Strings.KeyPattern = TEXT("*");
+    Store.FilterNodes(Strings, Result);
+    TestEqual(TEXT("Every test has to pass"), SetBits(Result.Matches), TArray<uint32>({ Alpha }));
+
+    // A view of the filter lists only the items it shows, and all children below a match
+    FJsonTreeFilterView View(Nulls);
+    View.Apply(Store);
+    TArray<uint32> TopLevel;
+    for (const FJsonTreeNode* Item : View.GetTopLevelItems())
+    {
+        TopLevel.Add(Item->Container.Self);
+    }
+    TestEqual(TEXT("Filtered top-level items"), TopLevel, TArray<uint32>({ B, E }));
+    TArray<const FJsonTreeNode*> Children;
+    TestEqual(TEXT("Children shown under b"), View.GetChildren(Store, Store.GetNode(B), Children, MAX_uint32, true), uint32(1));
+    TestTrue(TEXT("Only the match is listed under b"), Children.Num() == 1 && Children[0] == &Store.GetNode(C));
+    TestEqual(TEXT("Matches through the view"), View.GetNumMatches(), 2);
+    TestFalse(TEXT("Elements outside a match aren't listed"), Children.Contains(&Store.GetNode(E1)));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
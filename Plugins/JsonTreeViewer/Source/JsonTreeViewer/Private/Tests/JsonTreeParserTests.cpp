@@ -0,0 +1,377 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "JsonTreeTestHelpers.h"
+#include "JsonTreeParser.h"
+#include "JsonTreeScanner.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonTreeParserEscapesTest, "JsonTreeViewer.Parser.Escapes", JSONTREEVIEWER_TEST_FLAGS)
+
+bool FJsonTreeParserEscapesTest::RunTest(const FString& Parameters)
+{
+    FJsonTreeNodeStore Store;
+    if (!TestTrue(TEXT("Document with every escape parses"), JsonTreeTests::BuildStore(Store, TEXT(R"({"s":"a\"b\\c\/d\b\f\n\r\t","k\"ey":1,"u":"\u00e9\u4E2D"})"))))
+    {
+        return false;
+    }
+
+    const uint8 Unescaped[] = { 'a', '"', 'b', '\\', 'c', '/', 'd', '\b', '\f', '\n', '\r', '\t' };
+    const uint32 Escaped = JsonTreeTests::FindMember(Store, 0, "s");
+    TestTrue(TEXT("Short escapes are decoded"), Escaped != FJsonTreeNodeStore::InvalidIndex
+        && JsonTreeTests::HasBytes(Store.GetValue(Store.GetNode(Escaped)), TConstArrayView<uint8>(Unescaped, UE_ARRAY_COUNT(Unescaped))));
+    TestTrue(TEXT("Member names are unescaped"), JsonTreeTests::FindMember(Store, 0, "k\"ey") != FJsonTreeNodeStore::InvalidIndex);
+
+    const uint8 Unicode[] = { 0xC3, 0xA9, 0xE4, 0xB8, 0xAD };
+    const uint32 UnicodeIndex = JsonTreeTests::FindMember(Store, 0, "u");
+    TestTrue(TEXT("\\u escapes of either case are encoded as UTF-8"), UnicodeIndex != FJsonTreeNodeStore::InvalidIndex
+        && JsonTreeTests::HasBytes(Store.GetValue(Store.GetNode(UnicodeIndex)), TConstArrayView<uint8>(Unicode, UE_ARRAY_COUNT(Unicode))));
+
+    // The search index unescapes text it reads straight from the source the same way
+    const ANSICHAR Raw[] = R"(x\tyA\\)";
+    TArray<UTF8CHAR> Decoded;
+    TestTrue(TEXT("UnescapeString accepts valid escapes"), FJsonTreeParser::UnescapeString(reinterpret_cast<const uint8*>(Raw), FCStringAnsi::Strlen(Raw), Decoded));
+    const uint8 DecodedRaw[] = { 'x', '\t', 'y', 'A', '\\' };
+    TestTrue(TEXT("UnescapeString matches the parser"), JsonTreeTests::HasBytes(FUtf8StringView(Decoded.GetData(), Decoded.Num()), TConstArrayView<uint8>(DecodedRaw, UE_ARRAY_COUNT(DecodedRaw))));
+    Decoded.Reset();
+    const ANSICHAR Trailing[] = R"(abc\)";
+    TestFalse(TEXT("UnescapeString rejects a trailing backslash"), FJsonTreeParser::UnescapeString(reinterpret_cast<const uint8*>(Trailing), FCStringAnsi::Strlen(Trailing), Decoded));
+
+    FString Error;
+    int32 ErrorLine = 0;
+    int32 ErrorColumn = 0;
+    TestFalse(TEXT("Unknown escape fails"), JsonTreeTests::BuildStore(Store, TEXT(R"(["ab\x"])"), false, Error, ErrorLine, ErrorColumn));
+    TestEqual(TEXT("Unknown escape message"), Error, FString(TEXT("Invalid escape sequence")));
+    TestEqual(TEXT("Unknown escape is reported at its backslash"), ErrorColumn, 5);
+    TestFalse(TEXT("Short \\u escape fails"), JsonTreeTests::BuildStore(Store, TEXT(R"(["\u12G4"])"), false, Error, ErrorLine, ErrorColumn));
+    TestEqual(TEXT("Short \\u escape message"), Error, FString(TEXT("Invalid \\u escape")));
+    TestFalse(TEXT("Raw control character fails"), JsonTreeTests::BuildStore(Store, TEXT("[\"a\tb\"]"), false, Error, ErrorLine, ErrorColumn));
+    TestEqual(TEXT("Raw control character message"), Error, FString(TEXT("Control character in string")));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonTreeParserSurrogatesTest, "JsonTreeViewer.Parser.Surrogates", JSONTREEVIEWER_TEST_FLAGS)
+
+bool FJsonTreeParserSurrogatesTest::RunTest(const FString& Parameters)
+{
+    FJsonTreeNodeStore Store;
+    if (!TestTrue(TEXT("Document parses"), JsonTreeTests::BuildStore(Store, TEXT(R"(["\uD83D\uDE00","\uD83D\u0041","\uDE00x","\uD83Dx"])"))))
+    {
+        return false;
+    }
+
+    TArray<const FJsonTreeNode*> Items;
+    Store.GetTopLevelItems(Items);
+    if (!TestEqual(TEXT("Element count"), Items.Num(), 4))
+    {
+        return false;
+    }
+
+    // A pair makes one four-byte code point; a surrogate without its partner is kept on its own
+    // and doesn't swallow the character after it
+    const uint8 Pair[] = { 0xF0, 0x9F, 0x98, 0x80 };
+    const uint8 HighThenA[] = { 0xED, 0xA0, 0xBD, 'A' };
+    const uint8 LoneLow[] = { 0xED, 0xB8, 0x80, 'x' };
+    const uint8 LoneHigh[] = { 0xED, 0xA0, 0xBD, 'x' };
+    TestTrue(TEXT("Surrogate pair"), JsonTreeTests::HasBytes(Store.GetValue(*Items[0]), TConstArrayView<uint8>(Pair, UE_ARRAY_COUNT(Pair))));
+    TestTrue(TEXT("High surrogate followed by another escape"), JsonTreeTests::HasBytes(Store.GetValue(*Items[1]), TConstArrayView<uint8>(HighThenA, UE_ARRAY_COUNT(HighThenA))));
+    TestTrue(TEXT("Lone low surrogate"), JsonTreeTests::HasBytes(Store.GetValue(*Items[2]), TConstArrayView<uint8>(LoneLow, UE_ARRAY_COUNT(LoneLow))));
+    TestTrue(TEXT("Lone high surrogate"), JsonTreeTests::HasBytes(Store.GetValue(*Items[3]), TConstArrayView<uint8>(LoneHigh, UE_ARRAY_COUNT(LoneHigh))));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonTreeParserIntegersTest, "JsonTreeViewer.Parser.Integers", JSONTREEVIEWER_TEST_FLAGS)
+
+bool FJsonTreeParserIntegersTest::RunTest(const FString& Parameters)
+{
+    FJsonTreeNodeStore Store;
+    if (!TestTrue(TEXT("Document parses"), JsonTreeTests::BuildStore(Store,
+        TEXT("[9223372036854775807,-9223372036854775808,9223372036854775808,-9223372036854775809,12345678901234567,-0,0,1.0,1e2]"))))
+    {
+        return false;
+    }
+
+    TArray<const FJsonTreeNode*> Items;
+    Store.GetTopLevelItems(Items);
+    if (!TestEqual(TEXT("Element count"), Items.Num(), 9))
+    {
+        return false;
+    }
+
+    TestTrue(TEXT("MAX_int64 is an integer"), Items[0]->IsInteger() && Items[0]->Integer == MAX_int64);
+    TestTrue(TEXT("MIN_int64 is an integer"), Items[1]->IsInteger() && Items[1]->Integer == MIN_int64);
+    TestFalse(TEXT("MAX_int64 + 1 is a double"), Items[2]->IsInteger());
+    TestFalse(TEXT("MIN_int64 - 1 is a double"), Items[3]->IsInteger());
+
+    // Past 2^53 a double would round, so the exact digits only survive as an integer
+    TestTrue(TEXT("Integer beyond double precision"), Items[4]->IsInteger() && Items[4]->Integer == int64(12345678901234567));
+    TestEqual(TEXT("Integer beyond double precision displays exactly"), Store.GetValueString(*Items[4]), FString(TEXT("12345678901234567")));
+    TestEqual(TEXT("MIN_int64 displays exactly"), Store.GetValueString(*Items[1]), FString(TEXT("-9223372036854775808")));
+
+    TestTrue(TEXT("-0 keeps its sign as a double"), !Items[5]->IsInteger() && Items[5]->Number == 0.0 && 1.0 / Items[5]->Number < 0.0);
+    TestTrue(TEXT("0 is an integer"), Items[6]->IsInteger() && Items[6]->Integer == 0);
+    TestTrue(TEXT("A fraction makes a double"), !Items[7]->IsInteger() && Items[7]->Number == 1.0);
+    TestTrue(TEXT("An exponent makes a double"), !Items[8]->IsInteger() && Items[8]->Number == 100.0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonTreeParserErrorPositionTest, "JsonTreeViewer.Parser.ErrorPosition", JSONTREEVIEWER_TEST_FLAGS)
+
+bool FJsonTreeParserErrorPositionTest::RunTest(const FString& Parameters)
+{
+    struct FCase
+    {
+        const TCHAR* Json;
+        int32 Line;
+        int32 Column;
+    };
+    const FCase Cases[] =
+    {
+        { TEXT("{\n  \"a\": [1,\n  2,]\n}"), 3, 5 },      // The bracket after the trailing comma
+        { TEXT("{\"a\":\"abc"), 1, 6 },                   // An unterminated string, at its opening quote
+        { TEXT("[\"\u00e9\u00e9\", x]"), 1, 8 },          // Columns count characters, not UTF-8 bytes
+        { TEXT("[1]\r\n\r\n 2"), 3, 2 },                  // Text after the document
+        { TEXT("[1e,2]"), 1, 2 },                         // A number is reported where it starts
+        { TEXT("{\"a\" 1}"), 1, 6 },                      // A member without its colon
+        { TEXT(""), 1, 1 },                               // Nothing at all
+    };
+
+    for (const FCase& Case : Cases)
+    {
+        FJsonTreeNodeStore Store;
+        FString Error;
+        int32 ErrorLine = 0;
+        int32 ErrorColumn = 0;
+        for (const bool bLazy : { false, true })
+        {
+            const FString What = FString(Case.Json).ReplaceCharWithEscapedChar();
+            TestFalse(*(What + TEXT(" fails")), JsonTreeTests::BuildStore(Store, Case.Json, bLazy, Error, ErrorLine, ErrorColumn));
+            TestFalse(*(What + TEXT(" has an error message")), Error.IsEmpty());
+            TestEqual(*(What + TEXT(" error line")), ErrorLine, Case.Line);
+            TestEqual(*(What + TEXT(" error column")), ErrorColumn, Case.Column);
+        }
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonTreeParserStreamTest, "JsonTreeViewer.Parser.Stream", JSONTREEVIEWER_TEST_FLAGS)
+
+bool FJsonTreeParserStreamTest::RunTest(const FString& Parameters)
+{
+    // Chunks of 7 bytes split tokens, escapes and multi-byte characters everywhere
+    FString Json = TEXT("{\"list\":[");
+    for (int32 Index = 0; Index < 500; ++Index)
+    {
+        Json += FString::Printf(TEXT("%s{\"id\":%d,\"n\\\"ame\":\"\u00e9 %d\",\"f\":-1.5e3,\"t\":[true,false,null,[],{}]}"), Index > 0 ? TEXT(",") : TEXT(""), Index, Index);
+    }
+    Json += TEXT("],\"tail\":\"x\"}");
+    const FTCHARToUTF8 Utf8(*Json, Json.Len());
+    const uint8* Bytes = reinterpret_cast<const uint8*>(Utf8.Get());
+
+    FJsonTreeNodeStore Expected;
+    if (!TestTrue(TEXT("Reference build"), JsonTreeTests::BuildStore(Expected, Json)))
+    {
+        return false;
+    }
+
+    for (const bool bLazy : { false, true })
+    {
+        FJsonTreeNodeStore Store;
+        Store.BeginStreamBuild(FJsonTreeSource::FromStream(Utf8.Length()), bLazy);
+
+        FString Error;
+        int32 ErrorLine = 0;
+        int32 ErrorColumn = 0;
+        EJsonTreeBuildStep Step = EJsonTreeBuildStep::Pending;
+        TArray<const FJsonTreeNode*> NewItems;
+        int32 NumHandedOutMidway = 0;
+        for (int32 Offset = 0; Offset < Utf8.Length() && Step == EJsonTreeBuildStep::Pending; Offset += 7)
+        {
+            Store.AppendBuildInput(TConstArrayView<uint8>(Bytes + Offset, FMath::Min(7, Utf8.Length() - Offset)));
+            Step = Store.ContinueBuild(0.001, Error, ErrorLine, ErrorColumn);
+            if (Step == EJsonTreeBuildStep::Pending)
+            {
+                Store.GetNewTopLevelItems(NewItems);
+            }
+
+            // The list, the first member, is still open halfway through
+            if (Offset < Utf8.Length() / 2)
+            {
+                NumHandedOutMidway = NewItems.Num();
+            }
+        }
+        TestTrue(TEXT("A stream isn't done before its input ends"), Step == EJsonTreeBuildStep::Pending);
+        TestEqual(TEXT("Only complete top-level items are handed out"), NumHandedOutMidway, 0);
+
+        Store.EndBuildInput();
+        while (Step == EJsonTreeBuildStep::Pending)
+        {
+            Step = Store.ContinueBuild(0.001, Error, ErrorLine, ErrorColumn);
+        }
+        TestTrue(TEXT("Stream completes"), Step == EJsonTreeBuildStep::Done);
+        TestEqual(TEXT("Streamed tree matches a whole build"), JsonTreeTests::DescribeTree(Store), JsonTreeTests::DescribeTree(Expected));
+    }
+
+    // A syntax error in a stream is reported where a whole build reports it
+    const FString Broken = TEXT("[1,\n{\"a\":tru}]");
+    FString ExpectedError;
+    int32 ExpectedLine = 0;
+    int32 ExpectedColumn = 0;
+    FJsonTreeNodeStore Whole;
+    JsonTreeTests::BuildStore(Whole, Broken, false, ExpectedError, ExpectedLine, ExpectedColumn);
+
+    const FTCHARToUTF8 BrokenUtf8(*Broken, Broken.Len());
+    FJsonTreeNodeStore Streamed;
+    Streamed.BeginStreamBuild(FJsonTreeSource::FromStream(BrokenUtf8.Length()), false);
+    FString Error;
+    int32 ErrorLine = 0;
+    int32 ErrorColumn = 0;
+    EJsonTreeBuildStep Step = EJsonTreeBuildStep::Pending;
+    for (int32 Offset = 0; Offset < BrokenUtf8.Length() && Step == EJsonTreeBuildStep::Pending; ++Offset)
+    {
+        Streamed.AppendBuildInput(TConstArrayView<uint8>(reinterpret_cast<const uint8*>(BrokenUtf8.Get()) + Offset, 1));
+        Step = Streamed.ContinueBuild(0.001, Error, ErrorLine, ErrorColumn);
+    }
+    if (Step == EJsonTreeBuildStep::Pending)
+    {
+        Streamed.EndBuildInput();
+        Step = Streamed.ContinueBuild(0.001, Error, ErrorLine, ErrorColumn);
+    }
+    TestTrue(TEXT("Broken stream fails"), Step == EJsonTreeBuildStep::Failed);
+    TestEqual(TEXT("Broken stream error"), Error, ExpectedError);
+    TestEqual(TEXT("Broken stream error line"), ErrorLine, ExpectedLine);
+    TestEqual(TEXT("Broken stream error column"), ErrorColumn, ExpectedColumn);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonTreeParserSteppedTest, "JsonTreeViewer.Parser.Stepped", JSONTREEVIEWER_TEST_FLAGS)
+
+bool FJsonTreeParserSteppedTest::RunTest(const FString& Parameters)
+{
+    // Large enough for a step without time left to stop many times
+    FString Json = TEXT("[");
+    for (int32 Index = 0; Index < 20000; ++Index)
+    {
+        Json += FString::Printf(TEXT("%s{\"id\":%d,\"tags\":[\"a\",\"b\"]}"), Index > 0 ? TEXT(",") : TEXT(""), Index);
+    }
+    Json += TEXT("]");
+
+    FJsonTreeNodeStore Expected;
+    if (!TestTrue(TEXT("Reference build"), JsonTreeTests::BuildStore(Expected, Json)))
+    {
+        return false;
+    }
+
+    FJsonTreeNodeStore Store;
+    Store.BeginBuild(FJsonTreeSource::FromString(Json), false);
+    FString Error;
+    int32 ErrorLine = 0;
+    int32 ErrorColumn = 0;
+    int32 NumSteps = 0;
+    int32 NumHandedOut = 0;
+    EJsonTreeBuildStep Step = EJsonTreeBuildStep::Pending;
+    TArray<const FJsonTreeNode*> NewItems;
+    while (Step == EJsonTreeBuildStep::Pending)
+    {
+        Step = Store.ContinueBuild(0.0, Error, ErrorLine, ErrorColumn);
+        ++NumSteps;
+        if (Step == EJsonTreeBuildStep::Pending)
+        {
+            NewItems.Reset();
+            Store.GetNewTopLevelItems(NewItems);
+            NumHandedOut += NewItems.Num();
+        }
+    }
+    TestTrue(TEXT("Stepped build completes"), Step == EJsonTreeBuildStep::Done);
+    TestTrue(TEXT("A step without time left stops early"), NumSteps > 1);
+    TestTrue(TEXT("Top-level items are handed out while the build is under way"), NumHandedOut > 0 && NumHandedOut <= 20000);
+    TestEqual(TEXT("Stepped tree matches a whole build"), JsonTreeTests::DescribeTree(Store), JsonTreeTests::DescribeTree(Expected));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonTreeParserScannerTest, "JsonTreeViewer.Parser.ScannerAgreement", JSONTREEVIEWER_TEST_FLAGS)
+
+bool FJsonTreeParserScannerTest::RunTest(const FString& Parameters)
+{
+    // The scan sizes the store, so it has to count at least every node the parser builds. Without
+    // empty containers every comma and opening bracket starts a node, so the counts are exact.
+    const TCHAR* const Documents[] =
+    {
+        TEXT(R"({"a":[1,2,{"b":"x,y]}"}],"c\"":null})"),
+        TEXT(R"([[1,[2,[3]]],"\\",true])"),
+        TEXT(R"("just a string")"),
+        TEXT("42"),
+    };
+    for (const TCHAR* Json : Documents)
+    {
+        const FTCHARToUTF8 Utf8(Json);
+        FJsonTreeScanCounts Counts;
+        FJsonTreeNodeStore Store;
+        TestTrue(*FString::Printf(TEXT("%s scans"), Json), FJsonTreeScanner::Scan(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length(), Counts));
+        TestTrue(*FString::Printf(TEXT("%s parses"), Json), JsonTreeTests::BuildStore(Store, Json));
+        TestEqual(*FString::Printf(TEXT("%s node count"), Json), Counts.MaxNodes, int64(Store.Num()));
+    }
+
+    const FTCHARToUTF8 WithEmpty(TEXT(R"({"a":[],"b":{},"c":[[]]})"));
+    FJsonTreeScanCounts Counts;
+    FJsonTreeNodeStore Store;
+    FJsonTreeScanner::Scan(reinterpret_cast<const uint8*>(WithEmpty.Get()), WithEmpty.Length(), Counts);
+    JsonTreeTests::BuildStore(Store, TEXT(R"({"a":[],"b":{},"c":[[]]})"));
+    TestTrue(TEXT("Empty containers are over-counted, never under-counted"), Counts.MaxNodes >= int64(Store.Num()));
+
+    // What the scan rejects, the parser rejects too
+    const TCHAR* const Broken[] = { TEXT(R"({"a":"open)"), TEXT("[[1]"), TEXT("[1]]"), TEXT(R"(["\"])") };
+    for (const TCHAR* Json : Broken)
+    {
+        const FTCHARToUTF8 Utf8(Json);
+        TestFalse(*FString::Printf(TEXT("%s fails the scan"), Json), FJsonTreeScanner::Scan(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length(), Counts));
+        TestFalse(*FString::Printf(TEXT("%s fails the parse"), Json), JsonTreeTests::BuildStore(Store, Json));
+    }
+
+    // A document large enough to be cut into slices on the scanner's structure builds the same tree
+    // on worker threads as on one
+    FString Large = TEXT("{\"items\":[");
+    for (int32 Index = 0; Large.Len() < 5 * 1024 * 1024; ++Index)
+    {
+        Large += FString::Printf(TEXT("%s{\"id\":%d,\"s\":\"a\\\"],{%d\",\"v\":[%d.5,null]}"), Index > 0 ? TEXT(",") : TEXT(""), Index, Index, Index);
+    }
+    Large += TEXT("],\"after\":{\"x\":1}}");
+    const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe> Source = FJsonTreeSource::FromString(Large);
+    FJsonTreeNodeStore Serial;
+    FJsonTreeNodeStore Parallel;
+    FString Error;
+    int32 ErrorLine = 0;
+    int32 ErrorColumn = 0;
+    TestTrue(TEXT("Serial build"), Serial.Build(Source, false, false, [](float) { return true; }, Error, ErrorLine, ErrorColumn));
+    TestTrue(TEXT("Parallel build"), Parallel.Build(Source, false, true, [](float) { return true; }, Error, ErrorLine, ErrorColumn));
+    TestEqual(TEXT("Parallel build node count"), Parallel.Num(), Serial.Num());
+    TestTrue(TEXT("Parallel build matches the serial one"), JsonTreeTests::DescribeTree(Parallel) == JsonTreeTests::DescribeTree(Serial));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,147 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "JsonTreeTestHelpers.h"
+#include "JsonTreeTable.h"
+#include "Algo/StableSort.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    // Table of the array under the root member "rows"
+    TSharedPtr<FJsonTreeTable> BuildTestTable(const FString& Json)
+    {
+        const TSharedRef<FJsonTreeNodeStore> Store = MakeShared<FJsonTreeNodeStore>();
+        if (!JsonTreeTests::BuildStore(*Store, Json))
+        {
+            return nullptr;
+        }
+        const uint32 Rows = JsonTreeTests::FindMember(*Store, 0, "rows");
+        return Rows != FJsonTreeNodeStore::InvalidIndex ? FJsonTreeTable::Build(Store, Rows) : nullptr;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonTreeTableSortTest, "JsonTreeViewer.Table.Sort", JSONTREEVIEWER_TEST_FLAGS)
+
+bool FJsonTreeTableSortTest::RunTest(const FString& Parameters)
+{
+    const TSharedPtr<FJsonTreeTable> Table = BuildTestTable(TEXT(R"({"rows":[
+        {"k":2,"s":"b","f":1.5,"o":true,"m":1},
+        {"k":-1,"s":"B","f":-2.5,"o":false,"m":"x"},
+        {"k":2,"s":"a","f":-0.0,"o":true},
+        {"s":"\u00e9","f":null},
+        {"k":-1,"s":"a","f":1e300,"o":false},
+        {"k":null,"s":"","f":-1e-300}
+    ]})"));
+    if (!TestTrue(TEXT("Table builds"), Table.IsValid()))
+    {
+        return false;
+    }
+
+    struct FCase
+    {
+        const TCHAR* Column;
+        bool bDescending;
+        TArray<int32> Order;
+    };
+    const FCase Cases[] =
+    {
+        // Ties keep document order in both directions, and rows without a value come last
+        { TEXT("k"), false, { 1, 4, 0, 2, 3, 5 } },
+        { TEXT("k"), true, { 0, 2, 1, 4, 3, 5 } },
+        // Strings order by code point: "" < "B" < "a" < "b" < "\u00e9"
+        { TEXT("s"), false, { 5, 1, 2, 4, 0, 3 } },
+        { TEXT("s"), true, { 3, 0, 2, 4, 1, 5 } },
+        // Doubles order by value across exponents, with -0.0 between the negatives and the positives
+        { TEXT("f"), false, { 1, 5, 2, 0, 4, 3 } },
+        { TEXT("o"), false, { 1, 4, 0, 2, 3, 5 } },
+    };
+    for (const FCase& Case : Cases)
+    {
+        TArray<int32> Order;
+        const int32 Column = Table->FindColumn(Case.Column);
+        TestTrue(*FString::Printf(TEXT("Sort by %s"), Case.Column), Column != INDEX_NONE && Table->SortRows(Column, Case.bDescending, Order));
+        TestEqual(*FString::Printf(TEXT("Order by %s%s"), Case.Column, Case.bDescending ? TEXT(" descending") : TEXT("")), Order, Case.Order);
+    }
+
+    TArray<int32> Order;
+    TestFalse(TEXT("A mixed column has no order"), Table->SortRows(Table->FindColumn(TEXT("m")), false, Order));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonTreeTableRadixSortTest, "JsonTreeViewer.Table.RadixSortStability", JSONTREEVIEWER_TEST_FLAGS)
+
+bool FJsonTreeTableRadixSortTest::RunTest(const FString& Parameters)
+{
+    // Enough rows and spread for every digit pass to move rows around, and few enough distinct
+    // values for plenty of ties
+    constexpr int32 NumRows = 5000;
+    FRandomStream Random(20250601);
+    TArray<int64> Integers;
+    TArray<double> Numbers;
+    FString Json = TEXT("{\"rows\":[");
+    for (int32 Row = 0; Row < NumRows; ++Row)
+    {
+        const int64 Integer = int64(Random.RandRange(-50, 50)) * (int64(1) << Random.RandRange(0, 50));
+        const double Number = double(Random.RandRange(-100, 100)) * FMath::Pow(10.0, double(Random.RandRange(-20, 20)));
+        Integers.Add(Integer);
+        Numbers.Add(Number);
+        Json += FString::Printf(TEXT("%s{\"i\":%lld,\"n\":%.17g}"), Row > 0 ? TEXT(",") : TEXT(""), Integer, Number);
+    }
+    Json += TEXT("]}");
+
+    const TSharedPtr<FJsonTreeTable> Table = BuildTestTable(Json);
+    if (!TestTrue(TEXT("Table builds"), Table.IsValid()))
+    {
+        return false;
+    }
+
+    // Rows in document order, stably sorted by value, is what the radix sort has to produce
+    auto CheckOrder = [this, &Table](const TCHAR* Column, auto&& Less)
+    {
+        for (const bool bDescending : { false, true })
+        {
+            TArray<int32> Expected;
+            for (int32 Row = 0; Row < NumRows; ++Row)
+            {
+                Expected.Add(Row);
+            }
+            Algo::StableSort(Expected, [&Less, bDescending](int32 A, int32 B) { return bDescending ? Less(B, A) : Less(A, B); });
+
+            TArray<int32> Order;
+            TestTrue(*FString::Printf(TEXT("Sort by %s"), Column), Table->SortRows(Table->FindColumn(Column), bDescending, Order));
+            TestTrue(*FString::Printf(TEXT("Stable order by %s%s"), Column, bDescending ? TEXT(" descending") : TEXT("")), Order == Expected);
+        }
+    };
+    CheckOrder(TEXT("i"), [&Integers](int32 A, int32 B) { return Integers[A] < Integers[B]; });
+    CheckOrder(TEXT("n"), [&Numbers](int32 A, int32 B) { return Numbers[A] < Numbers[B]; });
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
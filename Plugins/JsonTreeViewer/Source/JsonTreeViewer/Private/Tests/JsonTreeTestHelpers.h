@@ -0,0 +1,106 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JsonTreeNodeStore.h"
+#include "JsonTreeSource.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Flags shared by the plugin's automation tests, which need no world and run in any build that has them
+#define JSONTREEVIEWER_TEST_FLAGS (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+namespace JsonTreeTests
+{
+    // Build a store from JSON text on the calling thread, with the syntax error on failure
+    inline bool BuildStore(FJsonTreeNodeStore& Store, const FString& Json, bool bLazy, FString& OutError, int32& OutErrorLine, int32& OutErrorColumn)
+    {
+        return Store.Build(FJsonTreeSource::FromString(Json), bLazy, false, [](float) { return true; }, OutError, OutErrorLine, OutErrorColumn);
+    }
+
+    inline bool BuildStore(FJsonTreeNodeStore& Store, const FString& Json, bool bLazy = false)
+    {
+        FString Error;
+        int32 ErrorLine = 0;
+        int32 ErrorColumn = 0;
+        return BuildStore(Store, Json, bLazy, Error, ErrorLine, ErrorColumn);
+    }
+
+    // Whether UTF-8 text holds exactly the given bytes
+    inline bool HasBytes(FUtf8StringView Text, TConstArrayView<uint8> Bytes)
+    {
+        return Text.Len() == Bytes.Num() && (Bytes.Num() == 0 || FMemory::Memcmp(Text.GetData(), Bytes.GetData(), Bytes.Num()) == 0);
+    }
+
+    // Child of a node by member name, InvalidIndex if there is none
+    inline uint32 FindMember(const FJsonTreeNodeStore& Store, uint32 Index, const ANSICHAR* Name)
+    {
+        return Store.FindChild(Index, FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Name), FCStringAnsi::Strlen(Name)));
+    }
+
+    // One line per node, "key=value", indented by depth, in display order; lazy children are built
+    // on the way. Two stores describe the same tree when their descriptions are equal.
+    inline void DescribeNode(FJsonTreeNodeStore& Store, const FJsonTreeNode& Node, int32 Depth, FString& Out)
+    {
+        for (int32 Indent = 0; Indent < Depth; ++Indent)
+        {
+            Out += TEXT("  ");
+        }
+        Out += Store.GetKeyString(Node);
+        Out += TEXT("=");
+        Out += Store.GetValueString(Node);
+        Out += TEXT("\n");
+
+        if (Node.HasPendingChildren())
+        {
+            Store.MaterializeChildren(Node.Container.Self);
+        }
+        TArray<const FJsonTreeNode*> Children;
+        Store.GetChildren(Node, Children);
+        for (const FJsonTreeNode* Child : Children)
+        {
+            DescribeNode(Store, *Child, Depth + 1, Out);
+        }
+    }
+
+    inline FString DescribeTree(FJsonTreeNodeStore& Store)
+    {
+        FString Out;
+        TArray<const FJsonTreeNode*> TopLevelItems;
+        Store.GetTopLevelItems(TopLevelItems);
+        for (const FJsonTreeNode* Item : TopLevelItems)
+        {
+            DescribeNode(Store, *Item, 0, Out);
+        }
+        return Out;
+    }
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
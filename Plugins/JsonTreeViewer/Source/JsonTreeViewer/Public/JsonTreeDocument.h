@@ -0,0 +1,242 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "JsonTreeDocument.generated.h"
+
+class FJsonTreeNodeStore;
+class FJsonTreeSearchIndex;
+class FJsonTreeSource;
+
+// What a document keeps besides the tree itself
+UENUM(BlueprintType)
+enum class EJsonTreeRetainSource : uint8
+{
+    None        UMETA(ToolTip = "Keep only the tree; lazy children are built up front"),
+    RawText     UMETA(ToolTip = "Also keep the UTF-8 JSON text (the mapped file for file input), which lazy children are parsed from"),
+    Dom         UMETA(ToolTip = "Keep the JSON text and cache the FJsonValue document once GetJsonValue asks for it"),
+};
+
+// Settings that decide how a document is turned into a tree
+struct FJsonTreeLoadOptions
+{
+    bool bLazyChildren = true;      // Only taken by LoadTree; documents are shared, so Load always builds them in full
+    bool bParallelBuild = true;
+    bool bBuildSearchIndex = false;
+    bool bUseDocumentCache = true;
+    bool bUseSnapshot = false;
+    EJsonTreeRetainSource RetainSource = EJsonTreeRetainSource::Dom;
+};
+
+/**
+ * FJsonTreeLoadStats
+ *
+ * Sizes and timings gathered by a load: the most recent InitJsonTree call, or the load of a document
+ */
+USTRUCT(BlueprintType)
+struct JSONTREEVIEWER_API FJsonTreeLoadStats
+{
+    GENERATED_BODY()
+
+    // Size of the UTF-8 JSON text that was parsed, in bytes
+    UPROPERTY(BlueprintReadOnly, Category = "JSON Tree Viewer")
+    int64 Bytes = 0;
+
+    // Number of tree items built from the document
+    UPROPERTY(BlueprintReadOnly, Category = "JSON Tree Viewer")
+    int32 Nodes = 0;
+
+    // Time spent mapping or reading the file (zero for raw JSON strings). Mapped pages are
+    // faulted in by the parse, so most of the disk time of a mapped file shows up in ParseMs
+    UPROPERTY(BlueprintReadOnly, Category = "JSON Tree Viewer")
+    float ReadMs = 0.f;
+
+    // Time spent validating the JSON text and building tree items from it, which is a single pass
+    UPROPERTY(BlueprintReadOnly, Category = "JSON Tree Viewer")
+    float ParseMs = 0.f;
+
+    // Time spent collecting the top-level items once the text has been parsed
+    UPROPERTY(BlueprintReadOnly, Category = "JSON Tree Viewer")
+    float BuildMs = 0.f;
+
+    // Whether the tree was mapped from the file's snapshot instead of parsed; ParseMs is then the
+    // time taken to open the snapshot
+    UPROPERTY(BlueprintReadOnly, Category = "JSON Tree Viewer")
+    bool bFromSnapshot = false;
+};
+
+/**
+ * FJsonTreeDocument
+ *
+ * A parsed JSON document, independent of any widget: its fully built node store, the text it was
+ * parsed from unless that was dropped, and its search index once one has been built. Any number
+ * of UJsonTreeViewerWidgets can show the same document, each with its own expansion, scroll
+ * position and search. Loading runs on any thread; once loaded the store is read-only, so every
+ * view can read it from any thread, and the document itself only changes through SetSearchIndex.
+ */
+class JSONTREEVIEWER_API FJsonTreeDocument
+{
+public:
+    // What LoadTree reads and builds: a store of the caller's own, and what it was built from
+    struct FLoadedTree
+    {
+        TSharedPtr<FJsonTreeNodeStore> NodeStore;
+        TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> Source;
+        FString FilePath;           // Set for a file
+        FJsonTreeLoadStats Stats;
+    };
+
+    // The store must be fully built: no lazy children, no build in progress
+    FJsonTreeDocument(const TSharedRef<const FJsonTreeNodeStore>& InNodeStore, const TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe>& InSource,
+        const TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe>& InSearchSource, const FString& InFilePath, const FJsonTreeLoadStats& InStats);
+
+    // Read, parse and fully build a document from a file path or raw JSON string; safe to call from any
+    // thread. OnProgress receives the completed fraction and returns false to abort the load. Returns null
+    // if the load failed, with the error set, or was aborted, with the error left empty.
+    static TSharedPtr<FJsonTreeDocument> Load(const FString& JsonPathOrString, const FJsonTreeLoadOptions& Options, TFunctionRef<bool(float)> OnProgress,
+        FString& OutError, int32& OutErrorLine, int32& OutErrorColumn);
+
+    // Load a tree the way Load does, but leave it the caller's own rather than making it a document,
+    // so it may keep lazy children to build as they are expanded. Returns false like Load returns null.
+    static bool LoadTree(const FString& JsonPathOrString, const FJsonTreeLoadOptions& Options, TFunctionRef<bool(float)> OnProgress,
+        FLoadedTree& OutTree, FString& OutError, int32& OutErrorLine, int32& OutErrorColumn);
+
+    // Map the file, or copy the raw JSON text, that Load would parse. OutFilePath is set for a file;
+    // on failure the error is set and null returned.
+    static TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> OpenSource(const FString& JsonPathOrString, FString& OutFilePath, FJsonTreeLoadStats& OutStats, FString& OutError);
+
+    // Whether the input is raw JSON text rather than a file path: it opens with '{' or '['
+    static bool IsJsonText(const FString& JsonPathOrString);
+
+    // Node table of the document; items are pointers into it
+    const TSharedRef<const FJsonTreeNodeStore>& GetNodeStore() const { return NodeStore; }
+
+    // UTF-8 text of the document; null if the load didn't retain it
+    const TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe>& GetSource() const { return Source; }
+
+    // Text to build a search index from: the retained text, or text kept only for indexing, which
+    // the index then reads its keys and values from; null if neither was kept
+    const TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe>& GetSearchSource() const { return Source.IsValid() ? Source : SearchSource; }
+
+    // Search index of the document; null until one has been built
+    const TSharedPtr<FJsonTreeSearchIndex, ESPMode::ThreadSafe>& GetSearchIndex() const { return SearchIndex; }
+
+    // Share a search index built from the document, releasing text kept only for it; game thread only
+    void SetSearchIndex(const TSharedPtr<FJsonTreeSearchIndex, ESPMode::ThreadSafe>& InSearchIndex);
+
+    // Path the document was read from, as it was given to Load; empty for a JSON string
+    const FString& GetFilePath() const { return FilePath; }
+
+    // Sizes and timings of the load that built the document
+    const FJsonTreeLoadStats& GetLoadStats() const { return Stats; }
+
+    // Bytes held by the document: node store, text unless it is a mapped file, and search index
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    // LoadTree for either kind of store. A shared store never changes once loaded, so its snapshot
+    // is saved from it; one of the caller's own is rebuilt for the snapshot, since it may change.
+    static bool LoadStore(const FString& JsonPathOrString, const FJsonTreeLoadOptions& Options, bool bShared, TFunctionRef<bool(float)> OnProgress,
+        FLoadedTree& OutTree, FString& OutError, int32& OutErrorLine, int32& OutErrorColumn);
+
+    const TSharedRef<const FJsonTreeNodeStore> NodeStore;
+    const TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> Source;
+
+    // Text kept for indexing when the load was asked for a search index but not to retain the text,
+    // and for the index once it is built
+    TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> SearchSource;
+
+    // Filled in by the first widget that finishes indexing the document
+    TSharedPtr<FJsonTreeSearchIndex, ESPMode::ThreadSafe> SearchIndex;
+
+    const FString FilePath;
+    const FJsonTreeLoadStats Stats;
+};
+
+class UJsonTreeDocument;
+
+// Fired on the game thread once LoadJsonTreeDocumentAsync has finished, with a document that may have failed to load
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnJsonTreeDocumentLoaded, UJsonTreeDocument*, Document);
+
+/**
+ * UJsonTreeDocument
+ *
+ * Blueprint handle to a loaded FJsonTreeDocument, e.g. one preloaded while a level streams in,
+ * to be shown by one or more UJsonTreeViewerWidgets through SetDocument. The whole tree is built
+ * up front, since it is shared. Loads go through the document cache, so a widget that opens the
+ * same input later with the same settings finds it there.
+ */
+UCLASS(BlueprintType)
+class JSONTREEVIEWER_API UJsonTreeDocument : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    // Load a file path or raw JSON string on the game thread
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer", meta = (AdvancedDisplay = "RetainSource"))
+    static UJsonTreeDocument* LoadJsonTreeDocument(const FString& JsonPathOrString, EJsonTreeRetainSource RetainSource = EJsonTreeRetainSource::Dom);
+
+    // Load a file path or raw JSON string on a background thread; OnLoaded fires on the game thread
+    // once it has finished, on a later tick even when the document was cached
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer", meta = (AdvancedDisplay = "RetainSource"))
+    static void LoadJsonTreeDocumentAsync(const FString& JsonPathOrString, FOnJsonTreeDocumentLoaded OnLoaded, EJsonTreeRetainSource RetainSource = EJsonTreeRetainSource::Dom);
+
+    // Wrap a document loaded from C++
+    static UJsonTreeDocument* Create(const TSharedRef<FJsonTreeDocument>& Document);
+
+    // True if the document was loaded, false if reading or parsing it failed
+    UFUNCTION(BlueprintPure, Category = "JSON Tree Viewer")
+    bool IsLoaded() const { return Document.IsValid(); }
+
+    // Error message of a failed load along with the line and column where parsing stopped
+    UFUNCTION(BlueprintPure, Category = "JSON Tree Viewer")
+    FString GetLoadError(int32& Line, int32& Column) const;
+
+    // Sizes and timings of the load that built the document
+    UFUNCTION(BlueprintPure, Category = "JSON Tree Viewer")
+    FJsonTreeLoadStats GetLoadStats() const;
+
+    // The loaded document; null if the load failed
+    const TSharedPtr<FJsonTreeDocument>& GetDocument() const { return Document; }
+
+private:
+    // Settings of a load started from Blueprint
+    static FJsonTreeLoadOptions MakeLoadOptions(EJsonTreeRetainSource RetainSource);
+
+    // Wrap the outcome of a load
+    static UJsonTreeDocument* Wrap(const TSharedPtr<FJsonTreeDocument>& Document, const FString& Error, int32 ErrorLine, int32 ErrorColumn);
+
+    TSharedPtr<FJsonTreeDocument> Document;
+
+    // Reader error of a failed load, with the line and column it stopped at
+    FString LoadError;
+    int32 LoadErrorLine = 0;
+    int32 LoadErrorColumn = 0;
+};
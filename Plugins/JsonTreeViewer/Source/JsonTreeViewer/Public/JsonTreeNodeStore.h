@@ -0,0 +1,511 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "HAL/CriticalSection.h"
+
+class FJsonTreeSource;
+struct FJsonTreeScanCounts;
+
+// Per-node state bits
+enum class EJsonTreeNodeFlags : uint8
+{
+    None            = 0,
+    PendingChildren = 1 << 0,   // Container whose children have not been built yet (lazy mode)
+    Dead            = 1 << 1,   // Unlinked by FJsonTreeNodeStore::Patch; kept allocated so pointers to it stay valid
+    Element         = 1 << 2,   // Array element; Key holds its index instead of a pool offset
+    Page            = 1 << 3,   // Groups a run of a large array's elements; Key holds the index of the first one
+    Integer         = 1 << 4,   // Number held exactly in Integer rather than in Number
+    AtKey           = 1 << 5,   // Member whose name starts with '@'
+    More            = 1 << 6,   // Row standing in for children that aren't listed yet; owned by the widget, Key holds how many
+};
+ENUM_CLASS_FLAGS(EJsonTreeNodeFlags);
+
+/**
+ * FJsonTreeNode
+ *
+ * One value of a JSON document stored in an FJsonTreeNodeStore. Nodes link to each other
+ * by index, keep their text in the store's string pool and refer to their member name by its id
+ * in the store's name table, so a node is a fixed 32 bytes. Numbers are kept in native form and
+ * only formatted when they are displayed.
+ */
+struct FJsonTreeNode
+{
+    // Location of a string in the string pool
+    struct FStringRef
+    {
+        uint32 Offset;
+        uint32 Length;
+    };
+
+    // Bookkeeping for objects and arrays, which have no display value
+    struct FContainerRef
+    {
+        uint32 Self;        // Index of this node in the store
+        uint32 Source;      // Byte offset of the container's text in the source, used while children are pending
+    };
+
+    uint32 Parent;                  // Index of the parent node, InvalidIndex for the root
+    uint32 FirstChild;              // Index of the first child, InvalidIndex if there is none
+    uint32 NextSibling;             // Index of the next child of the same parent, InvalidIndex for the last one
+    uint32 NumChildren;             // Number of children built so far
+    uint32 Key;                     // Name table id of the member name, 0 for none; an index for elements and pages
+    uint8 Type;                     // Underlying EJson type
+    EJsonTreeNodeFlags Flags;
+    uint16 Reserved;
+    union
+    {
+        FStringRef Value;           // Display text of strings, booleans and null
+        double Number;              // Numbers with a fraction or exponent, or outside the int64 range
+        int64 Integer;              // Integral numbers
+        FContainerRef Container;    // Objects and arrays
+    };
+
+    EJson GetType() const { return static_cast<EJson>(Type); }
+    bool IsContainer() const { return Type == uint8(EJson::Object) || Type == uint8(EJson::Array); }
+    bool HasPendingChildren() const { return EnumHasAnyFlags(Flags, EJsonTreeNodeFlags::PendingChildren); }
+    bool IsDead() const { return EnumHasAnyFlags(Flags, EJsonTreeNodeFlags::Dead); }
+    bool IsPage() const { return EnumHasAnyFlags(Flags, EJsonTreeNodeFlags::Page); }
+    bool HasIndexKey() const { return EnumHasAnyFlags(Flags, EJsonTreeNodeFlags::Element | EJsonTreeNodeFlags::Page); }
+    bool HasAtKey() const { return EnumHasAnyFlags(Flags, EJsonTreeNodeFlags::AtKey); }
+    bool IsMore() const { return EnumHasAnyFlags(Flags, EJsonTreeNodeFlags::More); }
+    bool IsInteger() const { return EnumHasAnyFlags(Flags, EJsonTreeNodeFlags::Integer); }
+    bool HasTextValue() const { return Type == uint8(EJson::String) || Type == uint8(EJson::Boolean) || Type == uint8(EJson::Null); }
+    double GetNumber() const { return IsInteger() ? double(Integer) : Number; }
+};
+
+static_assert(sizeof(FJsonTreeNode) <= 32, "FJsonTreeNode should stay within 32 bytes");
+
+// What FJsonTreeNodeStore::Patch changed
+struct FJsonTreePatchResult
+{
+    // Nodes that kept their address but now show something else
+    TArray<const FJsonTreeNode*> ChangedNodes;
+
+    // Whether any child list changed, i.e. items were added, removed or reordered
+    bool bStructureChanged = false;
+};
+
+// What FJsonTreeNodeStore::FilterNodes tests nodes for; a node matches if it passes every test that is set
+struct FJsonTreeNodeFilter
+{
+    // Bits (1 << EJson) of the types that match; 0 matches every type
+    uint32 TypeMask = 0;
+
+    // Wildcard pattern ('*' and '?') member names must match, ignoring case; empty matches every
+    // name. Array elements have no name, so they never match a pattern
+    FString KeyPattern;
+
+    // Only numbers from MinNumber to MaxNumber match
+    bool bNumberRange = false;
+    double MinNumber = 0.0;
+    double MaxNumber = 0.0;
+};
+
+// Nodes matching a filter and the nodes shown for it, i.e. the matches and everything above them; indexed by node
+struct FJsonTreeFilterResult
+{
+    TBitArray<> Matches;
+    TBitArray<> Shown;
+    int32 NumMatches = 0;
+};
+
+// One step of a path from the root to a node: an element of an array by its index, or a member of
+// an object by name, counting the members that repeat the name before it
+struct FJsonTreePathStep
+{
+    FUtf8StringView Key;
+    uint32 Position = 0;    // Index of the element, or of the member among those named Key
+    bool bElement = false;
+};
+
+// Outcome of one step of a build run in steps
+enum class EJsonTreeBuildStep : uint8
+{
+    Pending,    // Some of the document is left to parse
+    Done,
+    Failed,     // The document has a syntax error
+};
+
+/**
+ * FJsonTreeNodeStore
+ *
+ * Flat, arena-backed table of FJsonTreeNodes for one document. Nodes are allocated in fixed-size
+ * blocks that never move, so STreeView can use plain node pointers as its item type, and all
+ * text shares a single string pool. Member names are interned, so a name that repeats across
+ * thousands of objects is stored once. Everything is released at once by Reset().
+ *
+ * The const interface only reads nodes that have been built, so a store that is complete (not
+ * lazy, not building) can be read from any number of threads and views at once; its child lookup
+ * tables are the only thing built on demand, under a lock. Lazy children are built by the
+ * non-const MaterializeChildren calls, by whoever owns the store.
+ */
+class JSONTREEVIEWER_API FJsonTreeNodeStore
+{
+public:
+    static constexpr uint32 InvalidIndex = MAX_uint32;
+
+    // Arrays with more elements than this list them in pages of this many
+    static constexpr uint32 ArrayPageSize = 1000;
+
+    // Nodes refer to text by 32-bit offsets, so a document whose unescaped strings or member names
+    // need more than this fails to load
+    static constexpr int64 MaxStringBytes = MAX_uint32;
+
+    FJsonTreeNodeStore();
+    ~FJsonTreeNodeStore();
+
+    // Parse a UTF-8 document into the node table. With bLazy only the top level is built and
+    // containers keep the offset of their text until their children are requested; the whole
+    // document is validated either way. With bParallel an eager build of a large document splits the
+    // top-level items across worker threads. OnProgress receives the completed fraction and returns
+    // false to abort. On a syntax error the message and 1-based position are written to the Out parameters.
+    bool Build(const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe>& InSource, bool bLazy, bool bParallel, TFunctionRef<bool(float)> OnProgress,
+        FString& OutError, int32& OutErrorLine, int32& OutErrorColumn);
+
+    // Build a document like Build, serially, but in steps on the calling thread for when no worker
+    // thread can be spared: BeginBuild starts it and every ContinueBuild call parses for about
+    // MaxSeconds. Between steps only the items returned by GetNewTopLevelItems may be read, since
+    // the rest of the tree is still growing. On a syntax error the store is reset and the message
+    // and position are written to the Out parameters.
+    void BeginBuild(const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe>& InSource, bool bLazy);
+    EJsonTreeBuildStep ContinueBuild(double MaxSeconds, FString& OutError, int32& OutErrorLine, int32& OutErrorColumn);
+
+    // Build a document in steps like BeginBuild while its bytes are still arriving, e.g. from an HTTP
+    // download, into a source made by FJsonTreeSource::FromStream: AppendBuildInput adds the next chunk
+    // and EndBuildInput marks the end of the document. Chunks may split the text anywhere; ContinueBuild
+    // parses up to the last complete token received and returns Pending until the input has ended.
+    // AppendBuildInput returns false if the document grows past 2 GB, which is all a stream can hold.
+    void BeginStreamBuild(const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe>& InSource, bool bLazy);
+    bool AppendBuildInput(TConstArrayView<uint8> Bytes);
+    void EndBuildInput();
+
+    // Whether a build started by BeginBuild is under way, and the fraction of its text parsed so far
+    bool IsBuilding() const { return SteppedBuild.IsValid(); }
+    float GetBuildProgress() const;
+
+    // Append the top-level items completed since the last call while a stepped build is under way.
+    // The item being parsed is only added once it is complete. Array roots are paged when their
+    // build is done, so the final items come from GetTopLevelItems.
+    void GetNewTopLevelItems(TArray<const FJsonTreeNode*>& InOutItems);
+
+    // Release all nodes and strings
+    void Reset();
+
+    // Update this store in place to match a newer version of its document. Nodes that still exist
+    // at the same path (member name and occurrence, or element position) keep their address, so
+    // tree items, expansion and rows stay valid. Subtrees that only exist in NewStore are copied
+    // over, nodes that disappeared are marked dead but stay allocated until the store is rebuilt.
+    // Not available for a store loaded from a snapshot. Returns false with the message in OutError
+    // if the copied strings or names would need more than 4 GB; the store is then only partly
+    // patched, and NewStore should be shown instead.
+    bool Patch(FJsonTreeNodeStore& NewStore, FJsonTreePatchResult& OutResult, FString& OutError);
+
+    // Nodes unlinked by Patch or RemoveFirstRecords, which are only reclaimed by Compact or a new store
+    uint32 GetNumDeadNodes() const { return NumDeadNodes; }
+
+    // Start an empty document whose root is an array of records, e.g. the lines of an NDJSON file
+    void ResetToRecords();
+
+    // Parse one JSON value and append it as the last top-level item. The store is left as it was
+    // on a syntax error.
+    bool AppendRecord(const uint8* Data, int64 Size, FString& OutError, int32& OutErrorColumn);
+
+    // Copy the records of another record store to the end of this one. Returns false with the
+    // message in OutError, leaving the store as it was, if their strings or names would need more than 4 GB.
+    bool AppendRecords(const FJsonTreeNodeStore& From, TArray<const FJsonTreeNode*>& OutAppended, FString& OutError);
+
+    // Drop the oldest Count records; their nodes are marked dead
+    void RemoveFirstRecords(int32 Count);
+
+    // Move the live nodes into new blocks, releasing dead ones. Every node moves, so OutRemap maps
+    // old indices to new ones (InvalidIndex for dead nodes).
+    void Compact(TArray<uint32>& OutRemap);
+
+    // Node of this store at the same path as a node of another store, or InvalidIndex. The const
+    // version stops at pending children; the other one builds them along the path.
+    uint32 FindMatchingNode(const FJsonTreeNodeStore& Other, const FJsonTreeNode& OtherNode) const;
+    uint32 FindMatchingNode(const FJsonTreeNodeStore& Other, const FJsonTreeNode& OtherNode);
+
+    // Node at the end of a path from the root, or InvalidIndex; built in the same two ways
+    uint32 FindNodeAtPath(TConstArrayView<FJsonTreePathStep> Path) const;
+    uint32 FindNodeAtPath(TConstArrayView<FJsonTreePathStep> Path);
+
+    // Child of a node with the given member name (the first one if it repeats), or InvalidIndex.
+    // Large objects get a hash of their members on first use, so looking up one member doesn't
+    // walk the whole child list. Like every const lookup, only sees children that have been built.
+    uint32 FindChild(uint32 Index, FUtf8StringView Key) const;
+
+    // Child of a node at a position in its child list, or InvalidIndex. Long child lists get an
+    // index of their children on first use.
+    uint32 GetChildAt(uint32 Index, uint32 Position) const;
+
+    // Element of an array by its index in the JSON array, looking through pages, or InvalidIndex
+    uint32 GetElement(uint32 Index, uint32 ElementIndex) const;
+
+    // Number of nodes built so far
+    int32 Num() const { return int32(NumNodes); }
+
+    // Whether the nodes and string pool are read in place from a mapped tree snapshot (see
+    // FJsonTreeSnapshot). Such a store is fully built and read-only.
+    bool IsSnapshot() const { return Snapshot.IsValid(); }
+
+    // Whether containers may still have pending children, i.e. the store was built lazily and
+    // MaterializeAll hasn't run since
+    bool IsLazy() const { return Source.IsValid(); }
+
+    // Text the pending children of a lazy store are built from, null once it isn't lazy
+    const TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe>& GetSource() const { return Source; }
+
+    // Bytes allocated for nodes, strings and bookkeeping
+    SIZE_T GetAllocatedSize() const;
+
+    // Access a node by index
+    FJsonTreeNode& GetNode(uint32 Index) { return Blocks[Index >> BlockShift][Index & BlockMask]; }
+    const FJsonTreeNode& GetNode(uint32 Index) const { return Blocks[Index >> BlockShift][Index & BlockMask]; }
+
+    // Items shown at the top level of the tree: the members or elements of the root, or the root itself for a primitive
+    void GetTopLevelItems(TArray<const FJsonTreeNode*>& OutItems) const;
+
+    // Built children of a node; none while they are pending. At most MaxChildren are appended,
+    // which lets callers that only need to know whether there are any stop early.
+    void GetChildren(const FJsonTreeNode& Node, TArray<const FJsonTreeNode*>& OutChildren, uint32 MaxChildren = MAX_uint32) const;
+
+    // Build the pending children of the node at Index, one level deep
+    void MaterializeChildren(uint32 Index);
+
+    // Build the pending children of a node and of its descendants down to Depth levels below it.
+    // Pages only group elements, so they don't count as a level.
+    void MaterializeDescendants(uint32 Index, int32 Depth);
+
+    // Build every pending child, after which the store is no longer lazy
+    void MaterializeAll();
+
+    // Test every built node against a filter, spread over worker threads in blocks, then mark what
+    // is shown for it by walking up from each match to the first ancestor already shown. Pending
+    // children aren't tested, so a lazy store is built with MaterializeAll first.
+    void FilterNodes(const FJsonTreeNodeFilter& Filter, FJsonTreeFilterResult& OutResult) const;
+
+    // Children of a container that a filter shows, appending at most MaxChildren. Returns how many
+    // were appended, or with bCountAll how many there are in all, which walks the whole child list.
+    uint32 GetFilteredChildren(const FJsonTreeNode& Node, const FJsonTreeFilterResult& Filter, TArray<const FJsonTreeNode*>& OutChildren, uint32 MaxChildren, bool bCountAll) const;
+
+    // GetTopLevelItems, keeping only the items a filter shows
+    void GetFilteredTopLevelItems(const FJsonTreeFilterResult& Filter, TArray<const FJsonTreeNode*>& OutItems) const;
+
+    // Whether a container or one of its ancestors matches a filter, so its children are all listed
+    bool IsWithinMatch(const FJsonTreeNode& Node, const FJsonTreeFilterResult& Filter) const;
+
+    // Member name of a node as UTF-8, empty for array elements, pages and the root
+    FUtf8StringView GetKey(const FJsonTreeNode& Node) const;
+
+    // Distinct member names of the document by id; id 0 is the empty name
+    int32 GetNumNames() const { return Names.Num(); }
+    FUtf8StringView GetName(uint32 Id) const { return Names.Get(Id); }
+
+    // Display text of a string, boolean or null node as UTF-8, empty for numbers, objects and arrays
+    FUtf8StringView GetValue(const FJsonTreeNode& Node) const;
+
+    // Whether a boolean node holds true
+    bool IsTrue(const FJsonTreeNode& Node) const { return Node.Value.Offset == TrueOffset; }
+
+    // GetKey and GetValue converted for display; elements show as "[7]", pages as "[1000..1999]"
+    // and numbers are formatted here
+    FString GetKeyString(const FJsonTreeNode& Node) const;
+    FString GetValueString(const FJsonTreeNode& Node) const;
+
+    // GetValueString cut after MaxChars characters, converting only what is kept. OutHiddenBytes
+    // receives the number of UTF-8 bytes left out, 0 if the whole value fits.
+    FString GetValueString(const FJsonTreeNode& Node, int32 MaxChars, int64& OutHiddenBytes) const;
+
+private:
+    static constexpr uint32 BlockShift = 10;
+    static constexpr uint32 NodesPerBlock = 1u << BlockShift;
+    static constexpr uint32 BlockMask = NodesPerBlock - 1;
+
+    // Pool offsets of the shared boolean and null texts
+    static constexpr uint32 TrueOffset = 1;
+    static constexpr uint32 FalseOffset = 6;
+    static constexpr uint32 NullOffset = 12;
+
+    // Containers with fewer children are searched by walking their child list
+    static constexpr uint32 MinIndexedChildren = 64;
+
+    // Lookup tables for the children of one large container
+    struct FChildIndex
+    {
+        TArray<uint32> Children;                // Child indices in list order
+        TMap<uint32, int32> FirstWithName;      // Position of the first member with a given name id (objects only)
+
+        SIZE_T GetAllocatedSize() const { return Children.GetAllocatedSize() + FirstWithName.GetAllocatedSize(); }
+    };
+
+    // Each distinct member name stored once, with ids handed out in order of first use
+    class FNameTable
+    {
+    public:
+        FNameTable();
+
+        // Forget every name but the empty one
+        void Reset();
+
+        // Id of a name, adding it if it is new; InvalidIndex if the names would need more than MaxStringBytes
+        uint32 Add(FUtf8StringView Name);
+
+        // Id of a name, or InvalidIndex if no member has it
+        uint32 Find(FUtf8StringView Name) const;
+
+        FUtf8StringView Get(uint32 Id) const { return FUtf8StringView(Text.GetData() + Offsets[Id], Offsets[Id + 1] - Offsets[Id]); }
+        int32 Num() const { return Offsets.Num() - 1; }
+        int64 NumBytes() const { return Text.Num(); }
+        SIZE_T GetAllocatedSize() const;
+
+    private:
+        TArray64<UTF8CHAR> Text;                // Names back to back
+        TArray<uint32> Offsets;                 // Start of each name in Text, followed by the end of the last
+        TMap<uint32, uint32> FirstWithHash;     // Id of the most recent name with a given hash
+        TArray<uint32> NextWithHash;            // Id of the previous name with the same hash
+    };
+
+    // Name id a node is matched by; elements and pages count as having the empty name
+    static uint32 GetNameId(const FJsonTreeNode& Node) { return Node.HasIndexKey() ? 0 : Node.Key; }
+
+    // Lookup tables of a node's children, built on first use; null for short child lists
+    const FChildIndex* GetChildIndex(uint32 Index) const;
+
+    // Child of a container that has the same member name and occurrence as a node of another store
+    uint32 FindMatchingChild(uint32 Index, const FJsonTreeNodeStore& Other, const FJsonTreeNode& OtherNode) const;
+
+    friend class FJsonTreeParser;
+    friend class FJsonTreeSnapshot;
+
+    // Allocate one more block of nodes
+    void AddBlock();
+
+    // Report how much the store grew or shrank since the last report to FJsonTreeViewerStats
+    void UpdateMemoryStats();
+
+    // Append a node and return its index
+    uint32 AddNode(EJson Type, uint32 Parent, uint32 Key);
+
+    // Make room for what a structural scan counted, so the pool is allocated once
+    void Reserve(const FJsonTreeScanCounts& Counts);
+
+    // Append Count nodes for the caller to fill in and return the index of the first
+    uint32 AddNodesUninitialized(uint32 Count);
+
+    // Build the top-level items of the document in slices on worker threads and append the slices
+    // in order. Returns false without touching the store if the document doesn't split, or on a
+    // syntax error, which the serial parse then reports. OutCounts receives the scan's counts.
+    bool BuildParallel(const uint8* Data, int64 Size, TFunctionRef<bool(float)> OnProgress, FJsonTreeScanCounts& OutCounts, bool& bOutAborted);
+
+    // Append Child to the end of Parent's child list
+    void LinkChild(uint32 Parent, uint32 Child, uint32& LastChild);
+
+    // Move the elements of a complete array with more than ArrayPageSize of them under page nodes
+    void PageElements(uint32 Index);
+
+    // Key of a node of another store, as stored in this one; InvalidIndex if its name doesn't fit
+    uint32 CopyKey(const FJsonTreeNodeStore& From, const FJsonTreeNode& FromNode);
+
+    // Append a null-terminated copy of a string to the pool and return its offset, or InvalidIndex
+    // if the pool would need more than MaxStringBytes
+    uint32 AddString(FUtf8StringView String);
+
+    // Whether every string and name of another store would fit in this one's pool and name table
+    bool HasRoomFor(const FJsonTreeNodeStore& From) const;
+
+    // Position of a node among the siblings that share its member name
+    int32 GetOccurrence(const FJsonTreeNode& Node) const;
+
+    // Child of a node that a path step leads to, or InvalidIndex
+    uint32 FindPathChild(uint32 Index, const FJsonTreePathStep& Step) const;
+
+    // Bring the children of a matched container in line with From's, queueing matched pairs.
+    // The copy functions below return false once a string or name doesn't fit.
+    bool PatchChildren(uint32 Index, FJsonTreeNodeStore& From, uint32 FromIndex, TArray<TPair<uint32, uint32>>& OutPairs, FJsonTreePatchResult& OutResult);
+
+    // Make a node a copy of a node of another store, replacing its children
+    bool ReplaceNode(uint32 Index, const FJsonTreeNodeStore& From, uint32 FromIndex);
+
+    // Copy the value of a primitive from another store
+    bool CopyValue(uint32 Index, const FJsonTreeNodeStore& From, uint32 FromIndex);
+
+    // Copy the built children of a node of another store, and their descendants, under ToIndex
+    bool CopyChildren(const FJsonTreeNodeStore& From, uint32 FromIndex, uint32 ToIndex);
+
+    // Mark a node and its built descendants dead
+    void MarkDead(uint32 Index);
+
+    // Rebuild the string pool without the text of dead nodes and replaced values
+    void CompactStrings();
+
+    // Fixed-size node blocks; a node never moves once allocated. The blocks are BlockAllocations,
+    // or consecutive runs of the nodes of a mapped snapshot.
+    TArray<FJsonTreeNode*> Blocks;
+    TArray<TUniquePtr<FJsonTreeNode[]>> BlockAllocations;
+    uint32 NumNodes;
+
+    // Null-terminated UTF-8 strings; offset 0 is the empty string, followed by "true", "false" and "null".
+    // Empty for a snapshot store, whose pool is read from SnapshotStrings.
+    TArray64<UTF8CHAR> Strings;
+
+    // Mapped snapshot file holding the nodes and string pool of a snapshot store
+    TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> Snapshot;
+    const UTF8CHAR* SnapshotStrings;
+
+    // Member names, which node keys refer to by id
+    FNameTable Names;
+
+    // Pool bytes no longer referenced by any node
+    SIZE_T WastedStringBytes;
+
+    uint32 NumDeadNodes;
+
+    // Last top-level item of a record store, where AppendRecord links the next record
+    uint32 LastRecord;
+
+    // Sizes included in FJsonTreeViewerStats
+    uint32 ReportedNodes;
+    SIZE_T ReportedStringBytes;
+    SIZE_T ReportedArenaBytes;
+
+    // Child lookup tables by container index; dropped whenever child lists change. Const lookups
+    // add to them, so they are guarded, and allocated one by one so they don't move as more are added.
+    mutable TMap<uint32, TUniquePtr<FChildIndex>> ChildIndices;
+    mutable FCriticalSection ChildIndexLock;
+
+    // Document text that pending children are parsed from, held while any are left
+    TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> Source;
+
+    // Parser state between the steps of a build started by BeginBuild
+    struct FSteppedBuild;
+    TUniquePtr<FSteppedBuild> SteppedBuild;
+};
@@ -0,0 +1,160 @@
+//
+// JSON Tree Viewer
+// 
+// Customizable slate widget exposed to Blueprints that visualizes a JSON file in a tree view 
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2025 Rohan Singh
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "JsonTreeTable.generated.h"
+
+class FJsonTreeNodeStore;
+
+/**
+ * FJsonTreeColumnSummary
+ *
+ * Count, range and mean of the values in one table column; booleans count as 0 and 1
+ */
+USTRUCT(BlueprintType)
+struct JSONTREEVIEWER_API FJsonTreeColumnSummary
+{
+    GENERATED_BODY()
+
+    // Rows whose cell holds a value of the column's type, i.e. not missing, null or of another type
+    UPROPERTY(BlueprintReadOnly, Category = "JSON Tree Viewer")
+    int32 Count = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JSON Tree Viewer")
+    double Min = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JSON Tree Viewer")
+    double Max = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "JSON Tree Viewer")
+    double Mean = 0.0;
+};
+
+// What the cells of a table column hold, besides null and missing members
+enum class EJsonTreeColumnType : uint8
+{
+    Null,       // Nothing but null
+    Boolean,
+    Integer,    // Numbers that all fit an int64
+    Number,
+    String,
+    Mixed,      // Values of several types, objects or arrays
+};
+
+/**
+ * FJsonTreeTable
+ *
+ * An array of objects laid out in columns: one row per element and one column per member name.
+ * Each column keeps its values in one contiguous array of its type (double, int64, bool or string
+ * id), so a column is sorted or summarized without visiting a node. Built from the nodes of a store,
+ * which it keeps alive; a store patched by an incremental update needs a new table.
+ */
+class JSONTREEVIEWER_API FJsonTreeTable
+{
+public:
+    // Arrays of objects with more distinct member names than this aren't tables
+    static constexpr int32 MaxColumns = 256;
+
+    // Table of an array whose elements are all objects, with columns in order of first appearance,
+    // or null for any other node. Only built nodes are read, so a lazy store first builds the array's
+    // children and theirs: MaterializeDescendants(ArrayIndex, 2).
+    static TSharedPtr<FJsonTreeTable> Build(const TSharedRef<const FJsonTreeNodeStore>& InStore, uint32 ArrayIndex);
+
+    int32 NumRows() const { return Rows.Num(); }
+    int32 NumColumns() const { return Columns.Num(); }
+
+    // Node of a row's element
+    uint32 GetRowNode(int32 Row) const { return Rows[Row]; }
+
+    const FString& GetColumnName(int32 Column) const { return Columns[Column].Name; }
+    EJsonTreeColumnType GetColumnType(int32 Column) const { return Columns[Column].Type; }
+
+    // Column of a member name, or INDEX_NONE
+    int32 FindColumn(const FString& Name) const;
+
+    // Type of a cell's value, EJson::None where the element has no such member
+    EJson GetCellType(int32 Column, int32 Row) const { return EJson(Columns[Column].Kinds[Row]); }
+
+    // Display text of a cell: the value as the tree shows it, cut after MaxChars characters if
+    // MaxChars > 0, "{...}" or "[...]" for an object or array, and empty for a missing member
+    FString GetCellString(int32 Column, int32 Row, int32 MaxChars) const;
+
+    // Rows ordered by their values in a column. Ties, and then rows without a value of the column's
+    // type, keep their document order. Strings are ordered by their UTF-8 bytes, i.e. by code point.
+    // Returns false for a mixed column, which has no order.
+    bool SortRows(int32 Column, bool bDescending, TArray<int32>& OutOrder) const;
+
+    // Count, range and mean of a boolean or numeric column; false for other columns
+    bool Summarize(int32 Column, FJsonTreeColumnSummary& OutSummary) const;
+
+    // Bytes allocated for the columns, not counting the store
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    struct FColumn
+    {
+        FString Name;
+        EJsonTreeColumnType Type = EJsonTreeColumnType::Null;
+
+        // Type of every cell's value as an EJson, None for a missing member, and its member's node
+        // for display, InvalidIndex where missing
+        TArray<uint8> Kinds;
+        TArray<uint32> Nodes;
+
+        // Values of the column's type, one per row. Number columns hold NaN, which JSON can't
+        // express, in the rows without one; the other arrays hold zeros there.
+        TArray<double> Numbers;
+        TArray<int64> Integers;
+        TArray<bool> Booleans;
+        TArray<uint32> Strings;     // Index into DistinctStrings
+
+        // Rows holding a value of the column's type
+        int32 NumValues = 0;
+    };
+
+    explicit FJsonTreeTable(const TSharedRef<const FJsonTreeNodeStore>& InStore);
+
+    // Sort keys of a column's values, ordered like the values
+    void GetSortKeys(const FColumn& Column, bool bDescending, TArray<uint64>& OutKeys, TArray<int32>& OutRows, TArray<int32>& OutRest) const;
+
+    // Order of the distinct strings, worked out on the first sort by a string column
+    const TArray<uint32>& GetStringRanks() const;
+
+    TSharedRef<const FJsonTreeNodeStore> Store;
+
+    // Element node of every row
+    TArray<uint32> Rows;
+
+    TArray<FColumn> Columns;
+
+    // A node holding each distinct string value of the string columns
+    TArray<uint32> DistinctStrings;
+    mutable TArray<uint32> StringRanks;
+};
@@ -29,11 +29,26 @@
 
 #include "Modules/ModuleManager.h"
 
+class FJsonTreeDocumentCache;
+
 class FJsonTreeViewerModule : public IModuleInterface
 {
 public:
+	FJsonTreeViewerModule();
+	virtual ~FJsonTreeViewerModule();
 
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+	static FJsonTreeViewerModule& Get();
+
+	/** Parsed documents shared by all widgets; game thread only */
+	FJsonTreeDocumentCache& GetDocumentCache() { return *DocumentCache; }
+
+private:
+	TUniquePtr<FJsonTreeDocumentCache> DocumentCache;
+
+	// Publishes the per-frame stats
+	FDelegateHandle EndFrameHandle;
 };
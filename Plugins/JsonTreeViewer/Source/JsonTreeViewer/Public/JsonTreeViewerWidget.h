@@ -29,8 +29,108 @@
 
 #include "CoreMinimal.h"
 #include "Components/Widget.h"
+#include "Containers/Ticker.h"
+#include "HAL/ThreadSafeBool.h"
+#include "JsonTreeDocument.h"
+#include "JsonTreeNodeStore.h"
+#include "JsonTreeTable.h"
+#include "Widgets/Views/SHeaderRow.h"
 #include "JsonTreeViewerWidget.generated.h"
 
+// Fired on the game thread while a background load is running, with Progress in [0, 1]
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnJsonTreeLoadProgress, float, Progress);
+
+// Fired on the game thread once a load has finished and the tree has been swapped in
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnJsonTreeLoadCompleted, const FJsonTreeLoadStats&, Stats);
+
+// Fired on the game thread when the input could not be read or parsed
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnJsonTreeLoadFailed, const FString&, Error, int32, Line, int32, Column);
+
+// Fired on the game thread when records appended to a tailed file have been added to the tree,
+// with the number of old records dropped to stay within MaxRecords
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnJsonTreeRecordsAppended, int32, NumAppended, int32, NumDropped);
+
+// Fired on the game thread once a search has finished, with the number of matching items
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnJsonTreeSearchCompleted, int32, NumResults);
+
+// Type of value SetFilter keeps
+UENUM(BlueprintType)
+enum class EJsonTreeFilterType : uint8
+{
+    Any,
+    Null,
+    Boolean,
+    Number,
+    String,
+    Object,
+    Array,
+};
+
+/**
+ * FJsonTreeFilter
+ *
+ * Which items SetFilter keeps; an item is kept if it passes every test that is set
+ */
+USTRUCT(BlueprintType)
+struct JSONTREEVIEWER_API FJsonTreeFilter
+{
+    GENERATED_BODY()
+
+    // Keep only values of this type
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JSON Tree Viewer")
+    EJsonTreeFilterType Type = EJsonTreeFilterType::Any;
+
+    // Keep only members whose name matches this wildcard pattern ('*' and '?'), ignoring case;
+    // empty keeps any name. Array elements have no name, so a pattern leaves them out
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JSON Tree Viewer")
+    FString KeyPattern;
+
+    // Keep only numbers of at least MinNumber
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JSON Tree Viewer")
+    bool bUseMinNumber = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JSON Tree Viewer", meta = (EditCondition = "bUseMinNumber"))
+    double MinNumber = 0.0;
+
+    // Keep only numbers of at most MaxNumber
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JSON Tree Viewer")
+    bool bUseMaxNumber = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JSON Tree Viewer", meta = (EditCondition = "bUseMaxNumber"))
+    double MaxNumber = 0.0;
+};
+
+// Output of a load, produced without touching the widget so it can run on any thread
+struct FJsonTreeLoadResult;
+
+// Records parsed from the lines appended to a tailed file since the last poll
+struct FJsonTreeTailBatch;
+
+// Per-view state of a document: tailing, search, filter, table and child lists
+class FJsonTreeTail;
+class FJsonTreeSearch;
+class FJsonTreeFilterView;
+class FJsonTreeTableView;
+class FJsonTreeChildLists;
+
+// State of a load run on the game thread in time slices
+struct FJsonTreeSlicedLoad;
+
+// Input of the tree on show and the settings it was loaded with
+struct FJsonTreeLoadedInput;
+
+class SSearchBox;
+
+// Display text of one node, kept so rows that scroll back into view don't convert it again
+struct FJsonTreeRowText
+{
+    FText Key;
+    FText Value;
+
+    // Whether Value was cut at MaxValueChars
+    bool bTruncated = false;
+};
+
 /**
  * UJsonTreeViewer
  *
@@ -45,41 +145,245 @@ private:
     // Flag indicating whether the provided JSON string is valid
     bool _bValidJson;
 
+    // Sizes and timings of the last load
+    FJsonTreeLoadStats _LoadStats;
+
+    // Reader error of the last failed load, with the line and column it stopped at
+    FString _LoadError;
+    int32 _LoadErrorLine;
+    int32 _LoadErrorColumn;
+
     // Path to JSON file if reading from disk
     FString _JsonFilePath;
 
-    // Raw JSON string content
-    FString _JsonString;
+    // UTF-8 text of the document, kept unless RetainSource is None
+    TSharedPtr<FJsonTreeSource, ESPMode::ThreadSafe> _JsonSource;
 
-    // Parsed JSON value root
+    // FJsonValue document parsed by GetJsonValue, cached when RetainSource is Dom
     TSharedPtr<FJsonValue> _JsonValue;
 
+    // Document shown when other widgets may show it too, i.e. it came from the document cache or
+    // SetDocument; null while the tree is the widget's own (tailing, patched by incremental updates)
+    TSharedPtr<FJsonTreeDocument> _Document;
+
+    // Whether the document was passed to SetDocument or streamed in by InitJsonTreeFromStream, which
+    // rebuilds keep instead of loading JsonInput
+    bool _bDocumentSet;
+
+    // Input and settings of the tree loaded from JsonInput, with the file's stamp; null when the tree
+    // came from anywhere else
+    TSharedPtr<FJsonTreeLoadedInput> _LoadedInput;
+
+    // Incremented by every load; results from an older load are discarded
+    uint32 _LoadSerial;
+
+    // Raised to abort the background load that is currently running
+    TSharedPtr<FThreadSafeBool, ESPMode::ThreadSafe> _LoadCancelled;
+
+    // Whether a background load is in flight
+    bool _bLoading;
+
+    // Load run in slices when bTimeSlicedLoad is set or a stream is read, and the ticker that runs a slice every frame
+    TSharedPtr<FJsonTreeSlicedLoad> _SlicedLoad;
+    FTSTicker::FDelegateHandle _SliceTicker;
+
+    // File followed by StartTailingFile, and how much of it has been consumed
+    TSharedPtr<FJsonTreeTail> _Tail;
+
+    // Polls the tailed file for appended lines
+    FTSTicker::FDelegateHandle _TailTicker;
+
+    // Search index of the current document, the query and its matches
+    TSharedPtr<FJsonTreeSearch> _Search;
+
+    // Search box above the tree, when bShowSearchBox is set
+    TSharedPtr<SSearchBox> _SearchBox;
+
+    // Filter set by SetFilter and its view of the current node store; null while no filter is set.
+    // The tree doesn't show the view while a time-sliced load is building the store
+    TSharedPtr<FJsonTreeFilterView> _FilterView;
+
+    // Whether a lazy tree is being built in full on a worker thread for the filter
+    bool _bBuildingFilterTree;
+
+    // Array shown by ShowTable in place of the tree, and the order of its rows
+    TSharedPtr<FJsonTreeTableView> _Table;
+
+    // List view showing the table, and its header of one column per member name
+    TSharedPtr<SListView<const int32*>> _TableView;
+    TSharedPtr<SHeaderRow> _TableHeader;
+
     // Root Slate widget representing the JSON tree
     TSharedPtr<SWidget> _Widget;
 
+    // Node table backing the tree; items are pointers into it. A shared document's is read-only
+    TSharedPtr<const FJsonTreeNodeStore> _NodeStore;
+
+    // The same store while the tree is the widget's own, which it builds lazy children in, patches
+    // and appends records to; null while it shows a shared document
+    TSharedPtr<FJsonTreeNodeStore> _OwnedStore;
+
     // Underlying STreeView widget to display tree items
-    TSharedPtr<STreeView<TSharedPtr<class FTreeItem>>> _TreeView;
+    TSharedPtr<STreeView<const FJsonTreeNode*>> _TreeView;
 
     // Top-level items in the tree
-    TArray<TSharedPtr<class FTreeItem>> _TreeItems;
+    TArray<const FJsonTreeNode*> _TreeItems;
+
+    // Font used by every row: Font if it has a font object, the default Slate font otherwise
+    FSlateFontInfo _RowFont;
+
+    // Display text of recently generated rows, by node
+    TMap<const FJsonTreeNode*, FJsonTreeRowText> _RowTextCache;
+
+    // Values longer than MaxValueChars that were clicked to show in full
+    TSet<const FJsonTreeNode*> _RevealedValues;
+
+    // Child lists of expanded items, with their "... N more" rows
+    TSharedPtr<FJsonTreeChildLists> _ChildLists;
 
     // Generate a row widget for a given tree item
-    TSharedRef<ITableRow> GenerateRow(TSharedPtr<class FTreeItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
+    TSharedRef<ITableRow> GenerateRow(const FJsonTreeNode* Item, const TSharedRef<STableViewBase>& OwnerTable);
+
+    // Row content built from read-only SEditableText widgets, used when bSelectableText is set
+    TSharedRef<SWidget> MakeSelectableRowContent(const FJsonTreeRowText& RowText, const FSlateColor& RowKeyColor, const FSlateColor& RowValueColor);
+
+    // Cached display text for a node, converted from the node store on first use
+    const FJsonTreeRowText& GetRowText(const FJsonTreeNode& Item);
 
     // Retrieve children of a given tree item
-    void GetChildren(TSharedPtr<class FTreeItem> Item, TArray<TSharedPtr<class FTreeItem>>& OutChildren);
+    void GetChildren(const FJsonTreeNode* Item, TArray<const FJsonTreeNode*>& OutChildren);
+
+    // Build the lazy children of an item of the widget's own tree; a shared tree has none
+    void MaterializeChildren(const FJsonTreeNode& Item);
+
+    // Filter view the tree lists its items through, null while none is applied
+    FJsonTreeFilterView* GetAppliedFilter() const;
+
+    // Whether the children of an item are listed through the filter rather than all of them
+    bool IsFilteredItem(const FJsonTreeNode& Item) const;
+
+    // Compute the filter over the current node store and list its view, or the whole tree when no
+    // filter is set or the store is still being built
+    void ApplyFilter();
+
+    // Build the whole of the widget's lazy tree again on a worker thread, eagerly, then switch to it
+    // and apply the filter; nodes that aren't built aren't tested, and building them here would
+    // stall the game thread
+    void BuildFilterTree();
+
+    // Node at a JSON Pointer or JSONPath, building only the containers along the way; InvalidIndex if
+    // the path is malformed or leads nowhere, or while a time-sliced load is still building the tree
+    uint32 FindNodeAtPath(const FString& Path);
+
+    // Put the table's columns in the header and show it in place of the tree, or the tree if there is no table
+    void RefreshTable();
+
+    // List the table's rows in the order of a column's values, or in document order for INDEX_NONE
+    bool SortTableBy(int32 Column, bool bDescending);
+
+    // Generate a row widget for the table, and the cell of one of its columns
+    TSharedRef<ITableRow> GenerateTableRow(const int32* Row, const TSharedRef<STableViewBase>& OwnerTable);
+    TSharedRef<SWidget> GenerateTableCell(const FName& ColumnId, int32 Row);
+
+    // Header callbacks: the sort arrow of a column, and a click that sorts by it
+    EColumnSortMode::Type GetTableSortMode(int32 Column) const;
+    void HandleTableSort(EColumnSortPriority::Type Priority, const FName& ColumnId, EColumnSortMode::Type SortMode);
+
+    // Number of children listed when an item is expanded, MAX_uint32 for all of them
+    uint32 GetNumShownChildren(const FJsonTreeNode& Item) const;
+
+    // List the first NumShown children of an item, updating its "... N more" row
+    void ShowMoreChildren(const FJsonTreeNode& Item, uint32 NumShown);
+
+    // Tree callbacks: a collapsed item drops its child list; a shift-click expands or collapses an
+    // item with its descendants, expanding at most MaxExpandedItems of them
+    void HandleExpansionChanged(const FJsonTreeNode* Item, bool bExpanded);
+    void HandleSetExpansionRecursive(const FJsonTreeNode* Item, bool bExpand);
+
+    // A click on a row shows the rest of a truncated value, or the next children of a "... N more" row
+    void HandleItemClicked(const FJsonTreeNode* Item);
+
+    // Drop the cached row text along with what was revealed past the limits, once node pointers change
+    void ResetRowTexts();
+
+    // Read, parse and build a tree from a file path or raw JSON string with FJsonTreeDocument::Load;
+    // safe to call from any thread. OnProgress receives the completed fraction and returns false to abort the load.
+    static bool LoadJsonTree(const FString& JsonPathOrString, const FJsonTreeLoadOptions& Options, FJsonTreeLoadResult& OutResult, TFunctionRef<bool(float)> OnProgress);
+
+    // Gather the load settings from the widget's properties
+    FJsonTreeLoadOptions GetLoadOptions() const;
+
+    // Whether the tree on show was loaded from JsonInput with the current settings, and the file
+    // hasn't changed since, so a rebuild can keep it
+    bool IsInputShown() const;
+
+    // Abort any load in flight and return the serial of the load that replaces it
+    uint32 BeginLoad();
+
+    // Start a load that builds the tree on the game thread, a slice per frame; Result may hold its cache key
+    void BeginTimeSlicedLoad(const FString& JsonPathOrString, const FJsonTreeLoadOptions& Options, FJsonTreeLoadResult& Result);
+
+    // Run the next slice of the time-sliced load and list the top-level items it completed
+    bool TickTimeSlicedLoad(float DeltaTime);
+
+    // Show the time-sliced load's tree while it grows, keeping the tree shown before it to put back
+    void ShowGrowingTree();
+
+    // Hand the finished or failed time-sliced load to ApplyLoadResult
+    void FinishTimeSlicedLoad();
+
+    // Drop the time-sliced load, putting back the tree that was displayed before it
+    void StopTimeSlicedLoad();
+
+    // Swap a finished load into the widget and notify listeners
+    void ApplyLoadResult(FJsonTreeLoadResult& Result);
+
+    // Patch the current node store with a newly loaded one, refreshing only what changed
+    void ApplyIncrementalUpdate(FJsonTreeLoadResult& Result);
+
+    // Switch to a newly built node store of the widget's own, carrying expansion and scroll position over by path
+    void ReplaceTreeKeepingState(const TSharedRef<FJsonTreeNodeStore>& NodeStore, TArray<const FJsonTreeNode*>&& TreeItems);
+
+    // Check the tailed file for new lines and parse them in the background
+    bool PollTail(float DeltaTime);
+
+    // Add the records of a finished tail read to the tree, dropping the oldest ones past the cap
+    void ApplyTailBatch(const FJsonTreeTailBatch& Batch);
+
+    // Release the nodes of dropped records, carrying expansion over to the moved nodes
+    void CompactTailRecords();
+
+    // Index the current document for searching on a background thread
+    void BuildSearchIndex(const TSharedRef<FJsonTreeSource, ESPMode::ThreadSafe>& Source);
+
+    // Drop the index and results of the previous document
+    void ResetSearch();
+
+    // Run the current query against the search index on a background thread
+    void RunSearch();
+
+    // Expand the paths to the matches of a finished search and scroll to the first one
+    void ApplySearchResults();
+
+    // Item of the tree for one search match, with its ancestors expanded; null if it isn't in the tree
+    const FJsonTreeNode* RevealSearchMatch(int32 MatchIndex);
+
+    // Expand every item between the root and Item so that Item is listed
+    void ExpandAncestors(const FJsonTreeNode& Item);
 
-    // Validate JSON string syntax
-    bool IsValidJson(const FString& JsonString);
+    // Replace the expanded items with the containers down to Depth levels, breadth first, for as
+    // long as MaxExpandedItems allows; returns false if it ran out first
+    bool ExpandItems(int32 Depth);
 
-    // Parse raw JSON string into FJsonValue
-    bool ParseJsonContents(FString JsonString, TSharedPtr<FJsonValue>& OutJsonValue);
+    // Expand the containers under Items down to Depth levels, breadth first, with the same budget
+    bool ExpandDescendants(TConstArrayView<const FJsonTreeNode*> Items, int32 Depth);
 
-    // Build tree items from parsed JSON
-    void BuildTree(TSharedPtr<FJsonValue>& JsonValue);
+    // Search box callbacks: typing searches, Enter moves on to the next result
+    void HandleSearchTextChanged(const FText& Text);
+    void HandleSearchTextCommitted(const FText& Text, ETextCommit::Type CommitType);
 
-    // Recursively parse a JSON node into a tree item
-    TSharedPtr<FTreeItem> ParseNode(const TSharedPtr<FJsonValue>& JsonValue);
+    // Row contents for a node, shared by new rows and rows patched in place
+    TSharedRef<SWidget> MakeRowContent(const FJsonTreeNode& Item);
 
     // Map JSON value type to a Slate color for value text
     FSlateColor GetValueColorFromJsonType(EJson Type);
@@ -91,13 +395,116 @@ public:
     // Default constructor
     UJsonTreeViewerWidget();
 
+    // Pick up property changes, e.g. a new Font, and apply them to existing rows
+    virtual void SynchronizeProperties() override;
+
     // Release Slate resources when the widget is destroyed
     virtual void ReleaseSlateResources(bool bReleaseChildren) override;
 
+    // Abort any background load before the widget goes away
+    virtual void BeginDestroy() override;
+
     // Input JSON string or file path exposed to Blueprint
     UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true), Category = "JSON Tree Viewer")
     FString JsonInput;
 
+    // Build an item's children only when the tree first asks for them (i.e. when its parent is shown)
+    // instead of turning the whole document into tree items up front. Needs RetainSource other than None.
+    // Such a tree is the widget's own, since shared documents are built in full.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true), Category = "JSON Tree Viewer")
+    bool bLazyChildren;
+
+    // When the whole tree is built up front (bLazyChildren off or RetainSource None), build the
+    // top-level items of large documents on several worker threads
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true), Category = "JSON Tree Viewer")
+    bool bParallelBuild;
+
+    // What to keep in memory after the tree is built. None drops the JSON text, which makes the
+    // tree build eagerly
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true), Category = "JSON Tree Viewer")
+    EJsonTreeRetainSource RetainSource;
+
+    // Load JsonInput on a background thread when the widget is built instead of blocking the game thread
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true), Category = "JSON Tree Viewer")
+    bool bLoadAsync;
+
+    // Loading a new version of the document patches the current tree instead of replacing it:
+    // unchanged items keep their rows, expansion and scroll position, and only changed rows are rebuilt
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true), Category = "JSON Tree Viewer")
+    bool bIncrementalUpdate;
+
+    // Reuse a document already parsed by another widget, or by this one before UMG rebuilt it, as
+    // long as the file hasn't changed. Ignored with bIncrementalUpdate, which patches its own tree,
+    // and with bLazyChildren, which builds children in its own tree.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true), Category = "JSON Tree Viewer")
+    bool bShareDocuments;
+
+    // Keep a snapshot of the built tree of large files next to them (<file>.jtvcache), written in
+    // the background after the first load. Later loads of the unchanged file map the snapshot
+    // instead of parsing. Ignored with bIncrementalUpdate, as snapshot trees are read-only.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true), Category = "JSON Tree Viewer")
+    bool bUseTreeSnapshots;
+
+    // Have InitJsonTreeAsync (and bLoadAsync) build the tree on the game thread, parsing for at most
+    // TimeSliceBudgetMs per frame, instead of on a worker thread, for platforms that can't spare one.
+    // Top-level items are listed as soon as they are parsed. The build is serial, without tree
+    // snapshots; a search index (bShowSearchBox) is still built on a worker thread.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true), Category = "JSON Tree Viewer")
+    bool bTimeSlicedLoad;
+
+    // Parse time per frame of a time-sliced load, in milliseconds
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true, ClampMin = "0"), Category = "JSON Tree Viewer")
+    float TimeSliceBudgetMs;
+
+    // Longest value shown in a row, in characters. Longer values end in "..." and the size of the rest
+    // until their row is clicked; only the shown part is converted and laid out. 0 shows values in full
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true, ClampMin = "0"), Category = "JSON Tree Viewer")
+    int32 MaxValueChars;
+
+    // Most children listed under an expanded item, followed by a "... N more" row that lists the next
+    // as many when clicked. Top-level items are all listed. 0 lists every child
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true, ClampMin = "0"), Category = "JSON Tree Viewer")
+    int32 MaxShownChildren;
+
+    // Most items ExpandAll and ExpandToDepth reveal. Lazy children are built as their parents are
+    // expanded, so this also caps how much of the document one call parses
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true, ClampMin = "0"), Category = "JSON Tree Viewer")
+    int32 MaxExpandedItems;
+
+    // How often a tailed file is checked for new lines, in seconds
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0"), Category = "JSON Tree Viewer")
+    float TailPollInterval;
+
+    // Show a search box above the tree. Each loaded document is then indexed on a background thread;
+    // the index keeps the document's text, a parent and key per item, and its distinct keys and values
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true), Category = "JSON Tree Viewer")
+    bool bShowSearchBox;
+
+    // Color drawn behind the parts of keys and values that match the search text
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true), Category = "JSON Tree Viewer")
+    FSlateColor SearchHighlightColor;
+
+    // Progress of a background load
+    UPROPERTY(BlueprintAssignable, Category = "JSON Tree Viewer")
+    FOnJsonTreeLoadProgress OnLoadProgress;
+
+    // A load finished and the new tree is being displayed
+    UPROPERTY(BlueprintAssignable, Category = "JSON Tree Viewer")
+    FOnJsonTreeLoadCompleted OnLoadCompleted;
+
+    // A load failed; the previously displayed tree is kept. While tailing, fired with the first
+    // record of a batch that could not be parsed; the other records are still added
+    UPROPERTY(BlueprintAssignable, Category = "JSON Tree Viewer")
+    FOnJsonTreeLoadFailed OnLoadFailed;
+
+    // New records of a tailed file were added to the tree
+    UPROPERTY(BlueprintAssignable, Category = "JSON Tree Viewer")
+    FOnJsonTreeRecordsAppended OnRecordsAppended;
+
+    // A search finished and the paths to its first matches have been expanded
+    UPROPERTY(BlueprintAssignable, Category = "JSON Tree Viewer")
+    FOnJsonTreeSearchCompleted OnSearchCompleted;
+
     // Color for JSON keys
     UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true), Category = "JSON Tree Viewer")
     FSlateColor KeyColor;
@@ -126,6 +533,16 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true), Category = "JSON Tree Viewer")
     FMargin Padding;
 
+    // Fixed height of every row; 0 sizes rows to their content. Uniform rows make the
+    // tree view's scroll offsets exact without measuring each generated row
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true, ClampMin = "0"), Category = "JSON Tree Viewer")
+    float RowHeight;
+
+    // Show keys and values as selectable text that can be copied. Rows are painted as plain text
+    // otherwise, which is several times cheaper to create while scrolling
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true), Category = "JSON Tree Viewer")
+    bool bSelectableText;
+
     // Custom font which can be set by the user
     UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ExposeOnSpawn = true), Category = "JSON Tree Viewer")
     FSlateFontInfo Font;
@@ -137,30 +554,184 @@ public:
     // Initialize the JSON tree from a raw JSON string or file path
     UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
     void InitJsonTree(const FString JsonPathOrString);
-};
 
+    // Initialize the JSON tree on a background thread; a newer call cancels one that is still running
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    void InitJsonTreeAsync(const FString JsonPathOrString);
 
-/**
- * FTreeItem
- *
- * Represents a node in the JSON tree
- */
-class FTreeItem
-{
-public:
-    FString Key;                                // JSON key for object members or array index
-    FString Value;                              // String representation of the JSON value
-    EJson ValueType;                            // Underlying JSON type
-    TArray<TSharedPtr<FTreeItem>> ChildItems;   // Children of this node
+    // Show a document loaded with UJsonTreeDocument, which other widgets may be showing as well; each
+    // keeps its own expansion, scroll position and search. Documents are fully built, whatever
+    // bLazyChildren says. Rebuilds keep showing it until the next InitJsonTree, InitJsonTreeAsync
+    // or StartTailingFile.
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    void SetDocument(UJsonTreeDocument* Document);
 
-    // Default constructor
-    FTreeItem() : Key(TEXT("")), Value(TEXT("")), ValueType(EJson::None) {}
+    // SetDocument for a document loaded from C++
+    void ShowDocument(const TSharedRef<FJsonTreeDocument>& Document);
 
-    // Constructor for a node with a specific JSON type
-    FTreeItem(EJson Type) : Key(TEXT("")), Value(TEXT("")), ValueType(Type) {}
+    // Document shown, if other widgets may show it too; null while the tree is the widget's own
+    const TSharedPtr<FJsonTreeDocument>& GetDocument() const { return _Document; }
 
-    // Constructor with key, value & JSON type
-    FTreeItem(const FString& InKey, const FString& InValue, EJson InValueType)
-        : Key(InKey), Value(InValue), ValueType(InValueType) {
-    }
+    // True while a background or time-sliced load started by InitJsonTreeAsync, or a stream, is running
+    UFUNCTION(BlueprintPure, Category = "JSON Tree Viewer")
+    bool IsLoading() const;
+
+    // Start showing a document whose bytes arrive in chunks, e.g. the response body of an HTTP
+    // request, instead of buffering all of it first. Each chunk passed to AppendJsonTreeStream is
+    // parsed on the following ticks, for at most TimeSliceBudgetMs per frame, and top-level items show
+    // up as soon as they are complete; EndJsonTreeStream finishes the document. ExpectedBytes, e.g. the
+    // Content-Length, sizes the buffer up front and lets OnLoadProgress report the share received; 0
+    // if unknown. The text must be UTF-8. The tree shown before is put back if the stream turns out
+    // not to be valid JSON; any other load cancels the stream.
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    void InitJsonTreeFromStream(int64 ExpectedBytes = 0);
+
+    // Add the next bytes of the stream; a chunk may end anywhere, even inside a string or a UTF-8
+    // character. Returns false if there is no stream to add to, e.g. once it has failed.
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    bool AppendJsonTreeStream(const TArray<uint8>& Bytes);
+
+    // AppendJsonTreeStream for bytes that aren't in an array of their own, e.g. a view of a download buffer
+    bool AppendJsonTreeStreamBytes(TConstArrayView<uint8> Bytes);
+
+    // Mark the end of the stream. The rest is parsed on the following ticks, then OnLoadCompleted or
+    // OnLoadFailed is broadcast as for any other load.
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    bool EndJsonTreeStream();
+
+    // True between InitJsonTreeFromStream and EndJsonTreeStream, unless the stream failed or was cancelled
+    UFUNCTION(BlueprintPure, Category = "JSON Tree Viewer")
+    bool IsStreaming() const;
+
+    // Show a file of one JSON record per line (NDJSON, JSON Lines) as a list of records and keep
+    // adding the lines appended to it. Only the new bytes are read and parsed, on a background
+    // thread. MaxRecords > 0 keeps only the latest records so memory stays bounded.
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    bool StartTailingFile(const FString& FilePath, int32 MaxRecords = 0);
+
+    // Stop following the tailed file; the records read so far stay in the tree
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    void StopTailing();
+
+    // True between StartTailingFile and StopTailing or the next load
+    UFUNCTION(BlueprintPure, Category = "JSON Tree Viewer")
+    bool IsTailing() const { return _TailTicker.IsValid(); }
+
+    // Find the items whose key or value contains Query, ignoring case, on a background thread. A newer
+    // search cancels one that is still running. Needs bShowSearchBox; a search made while the document
+    // is still being indexed runs once the index is ready. Not available while tailing.
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    void Search(const FString& Query);
+
+    // Clear the search text and its highlights; expanded items stay expanded
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    void ClearSearch();
+
+    // Number of items matching the last finished search
+    UFUNCTION(BlueprintPure, Category = "JSON Tree Viewer")
+    int32 GetNumSearchResults() const;
+
+    // Scroll to the next match of the last search, wrapping around after the last one
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    void ShowNextSearchResult();
+
+    // Expand the items leading to a location in the document and scroll it into view. Takes a JSON
+    // Pointer ("/scene/actors/1532/components/3") or a simple JSONPath of member names and indices
+    // ("$.scene.actors[1532]", "$['odd key']"). Only the containers along the path are built; returns
+    // false if the path is malformed or leads nowhere, or while a time-sliced load is still building the tree.
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    bool NavigateToPath(const FString& Path);
+
+    // Expand every item, shallowest first, until MaxExpandedItems are revealed. Returns false if some
+    // items were left collapsed to stay within it
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    bool ExpandAll();
+
+    // Collapse every item
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    void CollapseAll();
+
+    // Show Depth levels below the top-level items and collapse everything deeper: 0 collapses
+    // everything, 1 expands the top-level items. Array pages don't count as a level. Like ExpandAll,
+    // stops at MaxExpandedItems and returns false if it did.
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    bool ExpandToDepth(int32 Depth);
+
+    // Show only the items matching Filter and the items leading to them; everything inside a matching
+    // object or array is listed. Every filter change is one pass over the document on worker threads,
+    // but the first filter of a document with lazy children builds the whole tree again on a worker
+    // thread first, and the unfiltered tree is shown until it's done. The filter stays
+    // set across loads; one set during a time-sliced load applies once the tree is built. Not available
+    // while tailing. Search results and NavigateToPath can lead to items the filter hides.
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    bool SetFilter(const FJsonTreeFilter& Filter);
+
+    // Show the whole tree again; expanded items stay expanded
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    void ClearFilter();
+
+    // True between SetFilter and ClearFilter
+    UFUNCTION(BlueprintPure, Category = "JSON Tree Viewer")
+    bool IsFiltered() const { return _FilterView.IsValid(); }
+
+    // Number of items matching the filter in the current tree
+    UFUNCTION(BlueprintPure, Category = "JSON Tree Viewer")
+    int32 GetNumFilterMatches() const;
+
+    // Show the array at Path, whose elements must all be objects, as a table in place of the tree: a
+    // row per element and a column per member name, sorted by clicking a column's header. Path takes
+    // the same forms as NavigateToPath; an empty path is the document itself. Each column's values
+    // are copied into an array of their type, so sorting or summarizing a column of a million rows
+    // takes milliseconds and visits no node. The table ignores any filter and closes when another
+    // document is loaded. Not available while tailing.
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    bool ShowTable(const FString& Path);
+
+    // Close the table and show the tree again
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    void ShowTree();
+
+    // True between ShowTable and ShowTree or the next load
+    UFUNCTION(BlueprintPure, Category = "JSON Tree Viewer")
+    bool IsShowingTable() const { return _Table.IsValid(); }
+
+    // Member names of the table's columns, in order of first appearance
+    UFUNCTION(BlueprintPure, Category = "JSON Tree Viewer")
+    TArray<FString> GetTableColumns() const;
+
+    // Order the table's rows by the values of a column, as a click on its header does. Ties keep
+    // their document order, and rows without a value of the column's type come last. Returns false if
+    // there is no such column, or if it holds values of several types, which have no order.
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    bool SortTable(const FString& Column, bool bDescending);
+
+    // Count, smallest, largest and mean of the numbers or booleans in a table column; false for
+    // columns of other values
+    UFUNCTION(BlueprintPure, Category = "JSON Tree Viewer")
+    bool GetTableColumnSummary(const FString& Column, FJsonTreeColumnSummary& Summary) const;
+
+    // Sizes and timings of the last InitJsonTree call
+    UFUNCTION(BlueprintPure, Category = "JSON Tree Viewer")
+    FJsonTreeLoadStats GetLoadStats() const { return _LoadStats; }
+
+    // Bytes held by this widget alone for the current document: a tree and text of its own, the
+    // FJsonValue of GetJsonValue, row text, search results, filter and table. A document shared with
+    // other widgets is left to GetSharedMemoryFootprint, and text mapped from a file isn't counted,
+    // since the file rather than memory backs it
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    int64 GetMemoryFootprint() const;
+
+    // Bytes held by the shared document shown, as FJsonTreeDocument counts them: its tree, text
+    // that isn't mapped and search index. Every widget showing it reports the same bytes; 0 while
+    // the tree is the widget's own
+    UFUNCTION(BlueprintCallable, Category = "JSON Tree Viewer")
+    int64 GetSharedMemoryFootprint() const;
+
+    // Error message of the last failed load along with the line and column where parsing stopped
+    UFUNCTION(BlueprintPure, Category = "JSON Tree Viewer")
+    FString GetLoadError(int32& Line, int32& Column) const;
+
+    // The current document as an FJsonValue, parsed from the retained text; null if RetainSource was None
+    TSharedPtr<FJsonValue> GetJsonValue();
 };
+